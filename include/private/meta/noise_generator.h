@@ -90,6 +90,21 @@ namespace lsp
             static constexpr float  NOISE_OFFSET_DFL 			= 0.0f;
             static constexpr float  NOISE_OFFSET_STEP			= 0.1f;
 
+            static constexpr float  CACHE_LENGTH_MIN            = 1.0f;
+            static constexpr float  CACHE_LENGTH_MAX            = 20.0f;
+            static constexpr float  CACHE_LENGTH_DFL            = 5.0f;
+            static constexpr float  CACHE_LENGTH_STEP           = 0.01f;
+
+            static constexpr size_t SEED_MIN                    = 0;
+            static constexpr size_t SEED_MAX                    = 65535;
+            static constexpr size_t SEED_DFL                    = 0;
+            static constexpr size_t SEED_STEP                   = 1;
+
+            static constexpr float  DSP_LOAD_MIN                = 0.0f;
+            static constexpr float  DSP_LOAD_MAX                = 100.0f;
+            static constexpr float  DSP_LOAD_DFL                = 0.0f;
+            static constexpr float  DSP_LOAD_STEP               = 0.01f;
+
             static constexpr size_t CHANNELS_MAX                = 4;
             static constexpr size_t NUM_GENERATORS              = 4;
             static constexpr size_t MESH_POINTS                 = 640;
@@ -100,6 +115,8 @@ namespace lsp
                 NOISE_TYPE_MLS,
                 NOISE_TYPE_LCG,
                 NOISE_TYPE_VELVET,
+                NOISE_TYPE_SPECTRAL,
+                NOISE_TYPE_COUNTER,
 
                 NOISE_TYPE_DFL  = NOISE_TYPE_LCG
             };
@@ -138,6 +155,14 @@ namespace lsp
                 NOISE_VELVET_DFL = NOISE_VELVET_OVN
             };
 
+            enum inaudible_filter_selector_t
+            {
+                NOISE_INA_BUTTERWORTH,
+                NOISE_INA_CHEBYSHEV,
+
+                NOISE_INA_DFL = NOISE_INA_BUTTERWORTH
+            };
+
         	enum noise_mode_selector_t
 			{
         		CHANNEL_MODE_OVERWRITE,
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PLUGINS_COUNTER_NOISE_H_
+#define PRIVATE_PLUGINS_COUNTER_NOISE_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/noise/LCG.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * White noise generator based on the counter-based Philox4x32-10 random number generator.
+         * The value of each sample is the function of the seed and the sample index only, so
+         * there is no dependency between samples: the generator computes whole block of counters
+         * at once in vectorizable loops and can be moved to any position of the stream in constant time.
+         */
+        class counter_noise
+        {
+            private:
+                counter_noise & operator = (const counter_noise &);
+                counter_noise (const counter_noise &);
+
+            public:
+                static constexpr size_t BLOCK_SIZE  = 256;  // Number of samples in the internal buffer
+                static constexpr size_t LANES       = 4;    // Number of samples produced by one counter
+                static constexpr size_t GROUP       = 8;    // Alignment of the distribution transforms
+
+            protected:
+                uint32_t            vKey[2];            // Key of the generator
+                wsize_t             nPosition;          // Index of the next sample
+                dspu::lcg_dist_t    enDist;             // Distribution
+                float               fAmplitude;         // Amplitude
+                float               fOffset;            // Offset
+                uint32_t            vRaw[BLOCK_SIZE];   // Raw random numbers
+                float               vOut[BLOCK_SIZE];   // Samples of the distribution
+
+            protected:
+                void                generate_raw(wsize_t counter, size_t count);
+                void                map_distribution(size_t count);
+
+            public:
+                explicit counter_noise();
+                ~counter_noise();
+
+                void                construct();
+                void                destroy();
+
+                /**
+                 * Initialize the generator and move it to the beginning of the stream
+                 * @param seed seed of the stream
+                 */
+                void                init(uint32_t seed);
+
+            public:
+                /**
+                 * Set distribution of the noise, all distributions have the same
+                 * power as uniform noise with the same amplitude
+                 * @param dist distribution
+                 */
+                void                set_distribution(dspu::lcg_dist_t dist);
+
+                /**
+                 * Set amplitude of the noise
+                 * @param amplitude amplitude
+                 */
+                void                set_amplitude(float amplitude);
+
+                /**
+                 * Set offset of the noise
+                 * @param offset offset
+                 */
+                void                set_offset(float offset);
+
+                /**
+                 * Move to the specified sample of the stream
+                 * @param position index of the sample
+                 */
+                inline void         seek(wsize_t position)  { nPosition = position; }
+
+                /**
+                 * Get the index of the next sample of the stream
+                 * @return index of the next sample
+                 */
+                inline wsize_t      position() const        { return nPosition; }
+
+            public:
+                /**
+                 * Generate noise
+                 * @param dst destination buffer
+                 * @param count number of samples to generate
+                 */
+                void                process_overwrite(float *dst, size_t count);
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(dspu::IStateDumper *v) const;
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_PLUGINS_COUNTER_NOISE_H_ */
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PLUGINS_DSP_LOAD_H_
+#define PRIVATE_PLUGINS_DSP_LOAD_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Statistics of the time spent in one processing stage. The time is accumulated
+         * within the processing period and then committed as the load: the ratio between
+         * the time spent and the real-time duration of the period.
+         */
+        class dsp_load
+        {
+            private:
+                dsp_load & operator = (const dsp_load &);
+                dsp_load (const dsp_load &);
+
+            public:
+                static constexpr size_t BUCKETS     = 8;    // Number of histogram buckets
+
+            protected:
+                wsize_t             nTime;              // Time spent within the current period [ns]
+                wsize_t             nPeriods;           // Number of committed periods
+                float               fLast;              // Load of the last period
+                float               fMean;              // Running mean of the load
+                float               fMax;               // Maximum load
+                wsize_t             vHistogram[BUCKETS];// Number of periods for each load range
+
+            public:
+                explicit dsp_load();
+                ~dsp_load();
+
+                void                construct();
+                void                destroy();
+
+            public:
+                /**
+                 * Get the current time
+                 * @return current time in nanoseconds
+                 */
+                static wsize_t      timestamp();
+
+            public:
+                /**
+                 * Reset the statistics
+                 */
+                void                reset();
+
+                /**
+                 * Add the time elapsed since the start of the stage
+                 * @param start timestamp of the start of the stage
+                 * @return current timestamp which may be used as start of the next stage
+                 */
+                inline wsize_t      measure(wsize_t start)
+                {
+                    const wsize_t now   = timestamp();
+                    nTime              += now - start;
+                    return now;
+                }
+
+                /**
+                 * Commit the time accumulated within the period
+                 * @param period real-time duration of the period [ns]
+                 */
+                void                commit(float period);
+
+                /**
+                 * Get the load of the last period
+                 * @return load of the last period, 1 means the whole period
+                 */
+                inline float        last() const        { return fLast;     }
+
+                /**
+                 * Get the running mean of the load
+                 * @return running mean of the load
+                 */
+                inline float        mean() const        { return fMean;     }
+
+                /**
+                 * Get the maximum load
+                 * @return maximum load
+                 */
+                inline float        peak() const        { return fMax;      }
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(dspu::IStateDumper *v) const;
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_PLUGINS_DSP_LOAD_H_ */
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PLUGINS_NOISE_DIST_H_
+#define PRIVATE_PLUGINS_NOISE_DIST_H_
+
+#include <lsp-plug.in/common/types.h>
+
+#include <math.h>
+#include <string.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Batch transforms of uniformly distributed 32-bit random numbers into samples
+         * of the target distribution. The transforms have no branches and no calls of
+         * the math library, so the loops are vectorized by the compiler. All distributions
+         * have zero mean and the same power as uniform distribution in the range [-1, 1).
+         */
+        namespace noise_dist
+        {
+            inline float as_float(uint32_t x)
+            {
+                float f;
+                memcpy(&f, &x, sizeof(f));
+                return f;
+            }
+
+            inline uint32_t as_uint(float f)
+            {
+                uint32_t x;
+                memcpy(&x, &f, sizeof(x));
+                return x;
+            }
+
+            /**
+             * Natural logarithm of the positive normal number: the mantissa is reduced
+             * to the range [sqrt(0.5), sqrt(2)) and the logarithm of the mantissa is computed
+             * as 2*atanh((m-1)/(m+1)), the relative error is below 1e-6
+             * @param x positive normal number
+             * @return natural logarithm
+             */
+            inline float fast_log(float x)
+            {
+                const uint32_t b    = as_uint(x) - 0x3f3504f3U;            // Offset by the bits of sqrt(0.5)
+                const int32_t e     = int32_t(b) >> 23;                     // Exponent
+                const float m       = as_float((b & 0x007fffffU) + 0x3f3504f3U);
+                const float t       = (m - 1.0f) / (m + 1.0f);
+                const float t2      = t * t;
+                const float p       = 1.0f + t2 * (1.0f/3.0f + t2 * (1.0f/5.0f + t2 * (1.0f/7.0f + t2 * (1.0f/9.0f))));
+
+                return float(e) * float(M_LN2) + 2.0f * t * p;
+            }
+
+            /**
+             * Square root of the positive normal number: initial approximation of the reciprocal
+             * square root by the bit trick refined with two Newton iterations
+             * @param x positive normal number
+             * @return square root
+             */
+            inline float fast_sqrt(float x)
+            {
+                float y             = as_float(0x5f375a86U - (as_uint(x) >> 1));
+                y                   = y * (1.5f - 0.5f * x * y * y);
+                y                   = y * (1.5f - 0.5f * x * y * y);
+                return x * y;
+            }
+
+            /**
+             * Sine and cosine of the doubled angle: the values for the half angle in the range
+             * [-pi/2, pi/2) are computed by Taylor series, then the double-angle formulas are applied
+             * @param h half of the angle in the range [-pi/2, pi/2)
+             * @param s sine of the angle 2*h
+             * @param c cosine of the angle 2*h
+             */
+            inline void fast_sincos(float h, float *s, float *c)
+            {
+                const float h2      = h * h;
+                const float hs      = h * (1.0f - h2 * (1.0f/6.0f - h2 * (1.0f/120.0f - h2 * (1.0f/5040.0f - h2 * (1.0f/362880.0f)))));
+                const float hc      = 1.0f - h2 * (0.5f - h2 * (1.0f/24.0f - h2 * (1.0f/720.0f - h2 * (1.0f/40320.0f - h2 * (1.0f/3628800.0f)))));
+
+                *s                  = 2.0f * hs * hc;
+                *c                  = hc*hc - hs*hs;
+            }
+
+            /**
+             * Uniform distribution in the range [-1, 1)
+             * @param dst destination buffer
+             * @param src random numbers
+             * @param count number of samples
+             */
+            void uniform(float *dst, const uint32_t *src, size_t count);
+
+            /**
+             * Two-sided exponential (Laplace) distribution
+             * @param dst destination buffer
+             * @param src random numbers
+             * @param count number of samples
+             */
+            void exponential(float *dst, const uint32_t *src, size_t count);
+
+            /**
+             * Triangular distribution, the sum of two uniform 16-bit random numbers
+             * @param dst destination buffer
+             * @param src random numbers
+             * @param count number of samples
+             */
+            void triangular(float *dst, const uint32_t *src, size_t count);
+
+            /**
+             * Gaussian distribution, Box-Muller transform of the pairs of random numbers
+             * @param dst destination buffer
+             * @param src random numbers
+             * @param count number of samples, should be multiple of 8
+             */
+            void gaussian(float *dst, const uint32_t *src, size_t count);
+
+        } /* namespace noise_dist */
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_PLUGINS_NOISE_DIST_H_ */
@@ -22,14 +22,25 @@
 #ifndef PRIVATE_PLUGINS_NOISE_GENERATOR_H_
 #define PRIVATE_PLUGINS_NOISE_GENERATOR_H_
 
+#include <lsp-plug.in/common/atomic.h>
 #include <lsp-plug.in/dsp-units/ctl/Bypass.h>
 #include <lsp-plug.in/dsp-units/filters/ButterworthFilter.h>
+#include <lsp-plug.in/dsp-units/filters/FilterBank.h>
+#include <lsp-plug.in/dsp-units/filters/SpectralTilt.h>
 #include <lsp-plug.in/dsp-units/noise/Generator.h>
 #include <lsp-plug.in/dsp-units/util/Analyzer.h>
+#include <lsp-plug.in/dsp-units/util/Randomizer.h>
+#include <lsp-plug.in/ipc/IExecutor.h>
+#include <lsp-plug.in/ipc/ITask.h>
+#include <lsp-plug.in/ipc/Thread.h>
 #include <lsp-plug.in/plug-fw/plug.h>
 #include <lsp-plug.in/plug-fw/core/IDBuffer.h>
 
 #include <private/meta/noise_generator.h>
+#include <private/plugins/counter_noise.h>
+#include <private/plugins/dsp_load.h>
+#include <private/plugins/sample_ring.h>
+#include <private/plugins/spectral_noise.h>
 
 namespace lsp
 {
@@ -47,10 +58,73 @@ namespace lsp
             protected:
                 enum ch_update_t
                 {
-                    UPD_NOISE_TYPE              = 1 << 9,
-                    UPD_NOISE_MODE              = 1 << 10,
-                    UPD_NOISE_AMPLITUDE         = 1 << 11,
-                    UPD_NOISE_OFFSET            = 1 << 12
+                    UPD_NOISE_TYPE              = 1 << 9,       // Generator type and its parameters
+                    UPD_NOISE_MODE              = 1 << 10,      // Channel mode and mixing coefficients
+                    UPD_NOISE_AMPLITUDE         = 1 << 11,      // Generator amplitude
+                    UPD_NOISE_OFFSET            = 1 << 12,      // Generator offset
+                    UPD_NOISE_COLOR             = 1 << 13,      // Generator colour
+                    UPD_NOISE_INAUDIBLE         = 1 << 14,      // Inaudible mode of the generator
+
+                    UPD_NOISE_ALL               =
+                        UPD_NOISE_TYPE | UPD_NOISE_AMPLITUDE | UPD_NOISE_OFFSET |
+                        UPD_NOISE_COLOR | UPD_NOISE_INAUDIBLE
+                };
+
+                enum gen_consumer_t
+                {
+                    GC_FFT                      = 1 << 0,       // Generator spectrum analysis lane
+                    GC_CHANNEL                  = 1 << 1        // First channel, channel i is GC_CHANNEL << i
+                };
+
+                enum ina_filter_t
+                {
+                    INA_FILTER_BUTTERWORTH,
+                    INA_FILTER_CHEBYSHEV
+                };
+
+                enum job_type_t
+                {
+                    JOB_GENERATOR,                              // Render generator
+                    JOB_CHANNEL                                 // Process channel
+                };
+
+                enum job_state_t
+                {
+                    JOB_IDLE,                                   // Job is not scheduled
+                    JOB_READY,                                  // Job is ready for execution
+                    JOB_TAKEN,                                  // Job is executed by some thread
+                    JOB_DONE                                    // Job is completed
+                };
+
+                enum launch_t
+                {
+                    LAUNCH_WORKERS          = 1 << 0,           // Start worker threads
+                    LAUNCH_ANALYZER         = 1 << 1,           // Initialize the spectrum analyzer
+                    LAUNCH_ANALYSIS         = 1 << 2,           // Start the analysis thread
+                    LAUNCH_BUFFERS          = 1 << 3,           // Allocate larger buffers of the processing block
+                    LAUNCH_FREE             = 1 << 4,           // Free the replaced buffers of the processing block
+                    LAUNCH_ENGINES          = 1 << 5            // Re-create standby engines of generators
+                };
+
+                enum launcher_state_t
+                {
+                    LS_READY,                                   // Launcher is submitted and may be started
+                    LS_BUSY,                                    // Launcher is started and uses the plugin
+                    LS_CANCELLED                                // Launcher should not use the plugin anymore
+                };
+
+                enum an_state_t
+                {
+                    AN_DIRECT,                                  // Analyzer is owned by the audio thread
+                    AN_THREAD,                                  // Analyzer is owned by the analysis thread
+                    AN_RELEASE                                  // Audio thread requests the analyzer back
+                };
+
+                enum chart_engine_t
+                {
+                    CHART_GENERATOR,                            // Colour filter of the noise generator
+                    CHART_SPECTRAL,                             // Spectral noise generator
+                    CHART_COUNTER                               // Colour filter of the counter-based generator
                 };
 
                 enum ch_mode_t
@@ -60,20 +134,206 @@ namespace lsp
                     CH_MODE_MULT
                 };
 
-                typedef struct generator_t
+                typedef struct gen_params_t
+                {
+                    size_t                  nType;              // Noise type
+                    dspu::lcg_dist_t        enLCGDist;          // LCG distribution
+                    dspu::vn_velvet_type_t  enVelvetType;       // Velvet type
+                    float                   fVelvetWin;         // Velvet window
+                    float                   fVelvetARNd;        // Velvet ARN delta
+                    bool                    bVelvetCrush;       // Velvet crushing
+                    float                   fVelvetCrushProb;   // Velvet crushing probability
+                    dspu::ng_color_t        enColor;            // Noise colour
+                    dspu::stlt_slope_unit_t enSlopeUnit;        // Unit of the colour slope
+                    float                   fSlope;             // Colour slope
+                    float                   fAmplitude;         // Amplitude
+                    float                   fOffset;            // Offset
+                    bool                    bInaudible;         // Make the noise inaudible
+                    ina_filter_t            enInaFilter;        // Filter used to stop the audible band
+                } gen_params_t;
+
+                typedef struct chart_key_t
+                {
+                    chart_engine_t          enEngine;           // Engine which computes the chart
+                    dspu::ng_color_t        enColor;            // Noise colour
+                    dspu::stlt_slope_unit_t enSlopeUnit;        // Unit of the colour slope
+                    float                   fSlope;             // Colour slope
+                    size_t                  nSampleRate;        // Sample rate
+                    bool                    bInaudible;         // Inaudible mode
+                } chart_key_t;
+
+                typedef struct chart_t
+                {
+                    chart_key_t             sKey;               // Configuration the chart was computed for
+                    size_t                  nAccess;            // Time of the last access
+                    bool                    bValid;             // Chart contains data
+                    float                  *vData;              // Magnitude of the frequency response
+                } chart_t;
+
+                typedef struct chart_frame_t
+                {
+                    size_t                  nVersion;           // Version of the frame
+                    bool                    vActive[meta::noise_generator::NUM_GENERATORS];  // Activity of each generator
+                    float                  *vData[meta::noise_generator::NUM_GENERATORS];    // Frequency chart of each generator
+                } chart_frame_t;
+
+                typedef struct engine_t
                 {
                     dspu::NoiseGenerator    sNoiseGenerator;    // Noise Generator
                     dspu::ButterworthFilter sAudibleStop;       // Filter to stop the audible band
+                    dspu::FilterBank        sAudibleStopCheb;   // Chebyshev filter to stop the audible band
+                    spectral_noise          sSpectral;          // Frequency-domain noise generator
+                    counter_noise           sCounter;           // Counter-based noise generator
+                    dspu::SpectralTilt      sCounterColor;      // Colour filter of the counter-based noise generator
+                } engine_t;
+
+                class CacheRenderer: public ipc::ITask
+                {
+                    private:
+                        friend class noise_generator;
+
+                    protected:
+                        engine_t                sEngine;            // Own engine, not shared with the audio thread
+                        gen_params_t            sParams;            // Snapshot of generator parameters
+                        size_t                  nSampleRate;        // Sample rate of the engine
+                        uint32_t                nSeed;              // Seed of the engine
+                        size_t                  nLength;            // Number of samples to render
+                        size_t                  nCapacity;          // Capacity of the table
+                        float                  *vData;              // Rendered table
+
+                    public:
+                        explicit CacheRenderer();
+                        virtual ~CacheRenderer() override;
+
+                    public:
+                        virtual status_t        run() override;
+                };
+
+                typedef struct an_config_t
+                {
+                    float                   fReactivity;        // Reactivity
+                    float                   fShift;             // Shift gain
+                    bool                    bActive;            // Activity of the analyzer
+                    bool                    vEnabled[meta::noise_generator::CHANNELS_MAX * 2 + meta::noise_generator::NUM_GENERATORS]; // Channel activity
+                } an_config_t;
+
+                typedef struct block_t
+                {
+                    uint8_t                *pData;              // Allocated data
+                    uint8_t                *pPtr;               // Aligned pointer to the buffers
+                    size_t                  nSize;              // Maximum number of samples processed at once
+                    size_t                  nBytes;             // Size of the allocated data
+                } block_t;
+
+                class Analysis: public ipc::Thread
+                {
+                    private:
+                        noise_generator        *pCore;
+
+                    public:
+                        explicit Analysis(noise_generator *core);
+                        virtual ~Analysis() override;
+
+                    public:
+                        virtual status_t        run() override;
+                };
+
+                class Worker: public ipc::Thread
+                {
+                    private:
+                        noise_generator        *pCore;
+
+                    public:
+                        explicit Worker(noise_generator *core);
+                        virtual ~Worker() override;
+
+                    public:
+                        virtual status_t        run() override;
+                };
+
+                class Launcher: public ipc::ITask
+                {
+                    private:
+                        friend class noise_generator;
+
+                    protected:
+                        noise_generator        *pCore;
+                        uatomic_t               nState;             // Claim of the plugin by the launcher, see launcher_state_t
+                        size_t                  nRequest;           // Requested resources, see launch_t
+                        size_t                  nDone;              // Successfully allocated resources, see launch_t
+                        Analysis               *pAnalysis;          // Started analysis thread
+                        block_t                 sBlock;             // Allocated buffers of the processing block
+                        uint8_t                *pGarbage;           // Replaced buffers of the processing block to free
+                        size_t                  nEngines;           // Generators which standby engines should be re-created, bit mask
+                        size_t                  nEnginesDone;       // Generators which standby engines have been re-created, bit mask
+
+                    public:
+                        explicit Launcher(noise_generator *core);
+                        virtual ~Launcher() override;
+
+                    public:
+                        virtual status_t        run() override;
+                };
+
+                typedef struct job_t
+                {
+                    uatomic_t               nState;             // Job state, see job_state_t
+                    job_type_t              enType;             // Job type
+                    size_t                  nIndex;             // Index of generator or channel
+                    size_t                  nSamples;           // Number of samples to process
+                } job_t;
+
+                typedef struct generator_t
+                {
+                    engine_t                vEngines[2];        // Storage of the engines
+                    engine_t               *pEngine;            // Noise generation engine
+                    engine_t               *pStandby;           // Engine which replaces the used one on reseed
+                    bool                    bStandby;           // Standby engine is initialized and has not rendered anything
+                    bool                    bRendered;          // Engine has rendered samples, so the state of its filters is not clean
+                    bool                    bReseed;            // Reseed is pending until the standby engine is ready
+                    uint32_t                nReseed;            // Pending seed
+                    CacheRenderer          *pCache;             // Renderer of the noise table for the cached mode
+                    dspu::Randomizer        sRandom;            // Randomizer for the noise table playback
+                    dsp_load                sGenLoad;           // Load of the noise generation
+                    dsp_load                sInaLoad;           // Load of the inaudible filter
+                    dsp_load                sCacheLoad;         // Load of the noise table playback
 
                     // Parameters
+                    gen_params_t            sParams;            // Generator parameters
                     float                   fGain;              // The outpug gain of generator
                     bool                    bActive;
-                    bool                    bInaudible;
                     bool                    bUpdPlots;          // Whehter to update the plots
+                    bool                    bSyncChart;         // Frequency chart needs to be committed to the mesh
+                    bool                    bAnalytic;          // Spectrum is computed from the frequency chart instead of FFT
+                    float                   fSigma;             // Standard deviation of the white noise source
+                    bool                    bFrozen;            // Generator is not rendered, buffer contains silence
+                    bool                    bValid;             // Engine is initialized
+                    float                   fLevel;             // Output level within the current process() call
+                    bool                    bSparse;            // Generator output may be represented as a list of impulses
+                    ssize_t                 nImpulses;          // Number of impulses in the current block, negative if data is dense
+                    size_t                  nConsumers;         // Set of consumers of generated signal, see gen_consumer_t
+                    size_t                  nUpdate;            // Pending updates of the engine, see ch_update_t
+                    uint32_t                nSeed;              // Seed of the engine
+                    wsize_t                 nPosition;          // Number of samples rendered by the engine since seeding
+
+                    // Cached mode
+                    bool                    bCached;            // Play back the pre-rendered noise table
+                    bool                    bCacheDirty;        // The noise table needs to be rendered
+                    size_t                  nCacheLength;       // Requested length of the noise table
+                    size_t                  nCacheSize;         // Length of the noise table
+                    size_t                  nCacheCap;          // Capacity of the noise table
+                    size_t                  nCachePos;          // Read position of the current segment
+                    size_t                  nCacheLeft;         // Number of samples left in the current segment
+                    size_t                  nFadePos;           // Read position of the fading out segment
+                    size_t                  nFadeDone;          // Number of processed samples of the crossfade
+                    float                  *vCache;             // Noise table played by the audio thread
+                    const float            *vFadeData;          // Noise table of the fading out segment
 
                     // Buffers
                     float                  *vBuffer;            // Temporary buffer for generated data
                     float                  *vFreqChart;         // Frequency chart
+                    uint32_t               *vImpIdx;            // Positions of impulses for sparse output
+                    float                  *vImpAmp;            // Amplitudes of impulses for sparse output
 
                     // Input ports
                     plug::IPort            *pNoiseType;         // Noise Type Selector
@@ -82,6 +342,10 @@ namespace lsp
                     plug::IPort            *pSlSw;              // Solo Switch
                     plug::IPort            *pMtSw;              // Mute Switch
                     plug::IPort            *pInaSw;             // Make-Inaudible-Switch
+                    plug::IPort            *pInaFilter;         // Inaudible filter selector
+                    plug::IPort            *pCached;            // Cached mode switch
+                    plug::IPort            *pCacheLen;          // Length of the noise table
+                    plug::IPort            *pSeed;              // Seed of the generator
                     plug::IPort            *pLCGdist;           // LCG Distribution
                     plug::IPort            *pVelvetType;        // Velvet Type
                     plug::IPort            *pVelvetWin;         // Velvet Window
@@ -94,6 +358,7 @@ namespace lsp
                     plug::IPort            *pCslopeDBD;         // Colour Slope [dB-per-Decade]
                     plug::IPort            *pFft;               // FFT analysis flag
                     plug::IPort            *pMeterOut;          // Output level meter
+                    plug::IPort            *pLoad;              // DSP load meter
                     plug::IPort            *pMsh;               // Mesh for Filter Frequency Chart Plot
                     plug::IPort            *pSpectrum;          // Spectrum graph
                 } generator_t;
@@ -102,17 +367,27 @@ namespace lsp
                 {
                     // DSP processing modules
                     dspu::Bypass            sBypass;            // Bypass
+                    dsp_load                sMixLoad;           // Load of the mixing
+                    dsp_load                sBypassLoad;        // Load of the bypass
 
                     // Parameters
                     ch_mode_t               enMode;             // The Channel Mode
                     float                   vGain[meta::noise_generator::NUM_GENERATORS];   // Gain for each generator
                     float                   fGainIn;            // Input gain
                     float                   fGainOut;           // Output gain
+                    float                   vMix[meta::noise_generator::NUM_GENERATORS];    // Generator mixing coefficients with output gains applied
+                    float                   fMixIn;             // Input mixing coefficient with output gains applied
+                    size_t                  vSources[meta::noise_generator::NUM_GENERATORS]; // Indexes of active generators with non-zero mixing coefficients
+                    size_t                  nSources;           // Number of generators mixed into the channel
                     bool                    bActive;            // Activity flag
+                    size_t                  nUpdate;            // Pending updates of the channel, see ch_update_t
+                    float                   fLevelIn;           // Input level within the current process() call
+                    float                   fLevelOut;          // Output level within the current process() call
                     float                  *vInBuffer;          // Temporary buffer for processing data
                     float                  *vOutBuffer;         // Temporary buffer for processing data
                     float                  *vIn;                // Input buffer pointer
                     float                  *vOut;               // Output buffer pointer
+                    float                  *vOutData;           // Buffer that holds the output data of the current block
 
                     // Audio Ports
                     plug::IPort            *pIn;                // Input port
@@ -127,6 +402,7 @@ namespace lsp
                     plug::IPort            *pGainOut;           // Output gain
                     plug::IPort            *pMeterIn;           // Input level meter
                     plug::IPort            *pMeterOut;          // Output level meter
+                    plug::IPort            *pLoad;              // DSP load meter
                     plug::IPort            *pSpectrumIn;        // Input spectrum analysis
                     plug::IPort            *pSpectrumOut;       // Output spectrum analysis
                 } channel_t;
@@ -134,15 +410,91 @@ namespace lsp
             protected:
                 generator_t                 vGenerators[meta::noise_generator::NUM_GENERATORS];
                 dspu::Analyzer              sAnalyzer;          // Spectrum analyzer
+                sample_ring                 sAnRing;            // Samples passed to the analysis thread
+                an_config_t                 sAnConfig;          // Analyzer configuration, owned by the audio thread
+                an_config_t                 sAnShared;          // Analyzer configuration passed to the analysis thread
+                Analysis                   *pAnalysis;          // Analysis thread
+                uatomic_t                   nAnState;           // Owner of the analyzer, see an_state_t
+                uatomic_t                   nAnConfig;          // Non-zero if sAnShared is pending for the analysis thread
+                uatomic_t                   nAnSwap;            // Published spectrum slot with the fresh flag
+                size_t                      nAnFront;           // Spectrum slot read by the audio thread
+                size_t                      nAnBack;            // Spectrum slot written by the analysis thread
+                size_t                      nAnPeriod;          // Number of samples between spectrum updates
+                size_t                      nAnFrame;           // Number of samples analyzed since the last spectrum update
+                bool                        bAnThread;          // Analysis is requested to run on the analysis thread
+                bool                        bFftOn;             // Spectrum analysis is enabled
+                bool                        bFftThread;         // Spectrum analysis on the analysis thread is enabled
+                bool                        bAnDirty;           // Analyzer configuration has changed
+                float                      *vAnBuffers[meta::noise_generator::CHANNELS_MAX * 2 + meta::noise_generator::NUM_GENERATORS]; // Buffers of the analysis thread
+                float                      *vAnSpectra;         // Published spectra, three slots
+                float                      *vAnEnvelope;        // Envelope of the analyzer for each FFT bin
+                float                       fAnNorm;            // Analyzer level of white noise with unit deviation, without shift
+                float                       vLCGSigma[dspu::LCG_MAX]; // Standard deviation of each LCG distribution with unit amplitude
+                ipc::IExecutor             *pExecutor;          // Executor service
+                Worker                     *vWorkers[meta::noise_generator::NUM_GENERATORS - 1];  // Worker threads
+                size_t                      nWorkers;           // Number of worker threads
+                Launcher                   *pLauncher;          // Allocates resources outside of the audio thread
+                size_t                      nLaunch;            // Resources to be requested from the launcher, see launch_t
+                size_t                      nLaunched;          // Resources already requested from the launcher, see launch_t
+                size_t                      nEngineRequest;     // Generators which standby engines should be re-created, bit mask
+                bool                        bWorkers;           // Worker threads are started, owned by the audio thread
+                uatomic_t                   nParallel;          // Parallel rendering flag passed to the worker threads
+                size_t                      nSerialHold;        // Number of samples to render serially after a worker missed the deadline
+                bool                        bStalled;           // Some jobs missed the deadline and still are executed by workers
+                bool                        bSettingsPending;   // Settings are applied after workers complete the late jobs
+                job_t                       vJobs[meta::noise_generator::NUM_GENERATORS + meta::noise_generator::CHANNELS_MAX]; // Jobs
                 size_t                      nChannels;          // Number of channels
                 channel_t                  *vChannels;          // Noise Generator channels
                 float                      *vFreqs;             // Frequency list
                 uint32_t                   *vIndexes;           // Frequency indexes
                 float                      *vFreqChart;         // Temporary buffer for frequency chart
+                chart_t                     vCharts[meta::noise_generator::NUM_GENERATORS * 2]; // Cache of frequency charts
+                size_t                      nChartClock;        // Access counter of the chart cache
                 float                       fGainIn;            // Overall input gain
                 float                       fGainOut;           // Overall output gain
+                size_t                      nBypassHold;        // Number of samples until the bypass crossfade completes
+                size_t                      nCacheSegment;      // Length of the noise table playback segment
+                float                      *vFadeIn;            // Fade-in curve for the noise table playback
+                float                      *vFadeOut;           // Fade-out curve for the noise table playback
+                bool                        bBypass;            // Bypass state
+                bool                        bParallel;          // Parallel rendering
+                bool                        bUIActive;          // UI is active within current process() call
+                bool                        bDirect;            // Channels render directly to the output buffer
+                bool                        bSeeded;            // Deterministic seeding mode
                 uint8_t                    *pData;              // Allocated data
+                uint8_t                    *pBlockData;         // Allocated buffers of the processing block
+                uint8_t                    *pAnData;            // Allocated buffers of the analysis thread
+                size_t                      nDataSize;          // Size of the allocated data
+                size_t                      nBlockDataSize;     // Size of the allocated buffers of the processing block
+                size_t                      nAnDataSize;        // Size of the allocated buffers of the analysis thread
+                size_t                      nBlockSize;         // Maximum number of samples processed at once
+                size_t                      nMaxBlock;          // Maximum block length passed by the host
+                size_t                      nBlockRequest;      // Block length requested from the launcher
+                uint8_t                    *pBlockGarbage;      // Replaced buffers of the processing block to be freed by the launcher
+                size_t                      nTileSize;          // Number of samples passed through all stages at once, 0 for the whole block
+                bool                        bAnInit;            // Analyzer is initialized
+                bool                        bMeasure;           // DSP load measurement is enabled
+                dsp_load                    sAnLoad;            // Load of the spectrum analysis
+                dsp_load                    sTotalLoad;         // Load of the whole process() call
                 core::IDBuffer             *pIDisplay;          // Inline display buffer
+                uint32_t                   *vIDisplayIdx;       // Index of the chart point for each pixel of the inline display
+                float                       vIDisplayGridX[8];  // Positions of vertical grid lines of the inline display
+                float                       vIDisplayGridY[16]; // Positions of horizontal grid lines of the inline display
+                size_t                      nIDisplayGridX;     // Number of vertical grid lines
+                size_t                      nIDisplayGridY;     // Number of horizontal grid lines
+                size_t                      nIDisplayWidth;     // Width of the cached inline display geometry
+                size_t                      nIDisplayHeight;    // Height of the cached inline display geometry
+                size_t                      nIDisplayRate;      // Sample rate of the cached inline display geometry
+                chart_frame_t               vChartFrames[3];    // Frequency charts published for the inline display
+                uatomic_t                   nChartSwap;         // Published chart frame with the fresh flag
+                size_t                      nChartBack;         // Chart frame written by the audio thread
+                size_t                      nChartFront;        // Chart frame read by the inline display
+                size_t                      nChartVersion;      // Incremented each time the frequency charts change
+                size_t                      nIDisplayVersion;   // Version of the charts drawn on the inline display
+                plug::ICanvas              *pIDisplayCanvas;    // Canvas which contains the picture of the inline display
+                bool                        bIDisplayBypass;    // Bypass state drawn on the inline display
+                bool                        bIDisplayActive;    // Activity drawn on the inline display
+                bool                        bIDisplayValid;     // Inline display contains the actual picture
 
                 plug::IPort                *pBypass;            // Bypass
                 plug::IPort                *pGainIn;            // Input gain
@@ -152,17 +504,98 @@ namespace lsp
                 plug::IPort                *pFftGen;            // FFT generator analysis
                 plug::IPort                *pReactivity;        // FFT reactivity
                 plug::IPort                *pShiftGain;         // FFT gain shift
+                plug::IPort                *pFftThread;         // FFT analysis on the background thread
+                plug::IPort                *pFftAnalytic;       // Analytic spectrum of generators
+                plug::IPort                *pParallel;          // Parallel rendering
+                plug::IPort                *pSeeded;            // Deterministic seeding mode
+                plug::IPort                *pSeed;              // Global seed
+                plug::IPort                *pMeasure;           // DSP load measurement switch
+                plug::IPort                *pLoad;              // Overall DSP load meter
 
             protected:
                 void                do_destroy();
+                void                mix_generators(float *dst, const channel_t *c, size_t samples);
+                void                play_cache(generator_t *g, float *dst, size_t samples);
+                void                start_cache_segment(generator_t *g, const float *prev);
+                void                sync_cache(generator_t *g);
+                void                render_generator(generator_t *g, size_t samples);
+                template <ch_mode_t MODE>
+                void                process_channel(channel_t *c, size_t samples);
+                void                process_channel(channel_t *c, size_t samples);
+                void                process_channels(size_t samples);
+                void                commit_loads(size_t samples);
+                void                run_job(job_t *job);
+                size_t              claim_jobs();
+                bool                execute_jobs(size_t first, size_t count);
+                bool                jobs_settled();
+                void                silence_output(size_t offset, size_t samples);
+                void                start_workers();
+                size_t              init_standby(size_t mask);
+                void                finish_launch();
+                void                sync_launcher();
+                void                pass_through(size_t samples);
+                bool                restart_generator(generator_t *g, uint32_t seed, wsize_t position);
+                void                reseed_generator(generator_t *g, uint32_t seed);
+                bool                alloc_block(block_t *b, size_t size) const;
+                void                bind_block(const block_t *b);
+                bool                resize_buffers(size_t size);
+                bool                init_analyzer();
+                Analysis           *init_analysis_thread();
+                void                update_frequencies(float sr);
+                size_t              analysis_channels() const;
+                void                apply_analysis(const an_config_t *cfg);
+                void                sync_analysis();
+                void                release_analysis();
+                bool                run_analysis();
+                void                publish_spectra(float *dst);
+                void                output_spectrum(float *dst, size_t channel, uatomic_t state);
+                void                analytic_spectrum(float *dst, const generator_t *g) const;
+                void                update_freq_chart(generator_t *g);
+                bool                update_display_geometry(size_t width, size_t height);
+                void                publish_charts();
 
             protected:
-                inline ssize_t                      make_seed() const;
+                static ssize_t      extract_impulses(uint32_t *idx, float *amp, const float *src, size_t count, size_t limit);
+                static bool         init_engine(engine_t *e, uint32_t seed);
+                static void         reseed_engine(engine_t *e, uint32_t seed);
+                static void         destroy_engine(engine_t *e);
+                static void         update_engine_sample_rate(engine_t *e, size_t sr);
+                static void         configure_engine(engine_t *e, const gen_params_t *p, size_t flags);
+                static void         render_engine(engine_t *e, const gen_params_t *p, float *dst, size_t samples);
+                static void         generate_engine(engine_t *e, const gen_params_t *p, float *dst, size_t samples);
+                static void         filter_engine(engine_t *e, const gen_params_t *p, float *dst, size_t samples);
+                static void         dump_engine(dspu::IStateDumper *v, const char *name, const engine_t *e);
+                static void         dump_params(dspu::IStateDumper *v, const char *name, const gen_params_t *p);
+                static void         dump_analysis(dspu::IStateDumper *v, const char *name, const an_config_t *cfg);
+                static size_t       params_changes(const gen_params_t *a, const gen_params_t *b);
+                static bool         chart_key_equal(const chart_key_t *a, const chart_key_t *b);
+                static void         measure_lcg_sigma(float *dst);
+                static bool         an_config_equal(const an_config_t *a, const an_config_t *b);
+
+            protected:
+                static inline ssize_t               make_seed();
+                static uint32_t                     derive_seed(uint32_t seed, uint32_t salt);
                 static dspu::lcg_dist_t             get_lcg_dist(size_t value);
                 static dspu::vn_velvet_type_t       get_velvet_type(size_t value);
                 static dspu::ng_color_t             get_color(size_t value);
                 static dspu::stlt_slope_unit_t      get_color_slope_unit(size_t value);
                 static ch_mode_t                    get_channel_mode(size_t value);
+                static ina_filter_t                 get_ina_filter(size_t value);
+                static void                         design_audible_stop(dspu::FilterBank *fb, float sample_rate);
+
+            public:
+                /**
+                 * Snapshot of the generator stream. In the deterministic seeding mode the output
+                 * of the generator depends only on the seed, the settings and the number of samples
+                 * rendered since seeding, so the snapshot can be restored exactly.
+                 */
+                typedef struct snapshot_t
+                {
+                    uint32_t                nSeed;              // Seed of the engine
+                    wsize_t                 nPosition;          // Number of samples rendered since seeding
+                    size_t                  nSampleRate;        // Sample rate
+                    gen_params_t            sParams;            // Generator parameters
+                } snapshot_t;
 
             public:
                 explicit noise_generator(const meta::plugin_t *meta);
@@ -177,6 +610,41 @@ namespace lsp
                 virtual void        process(size_t samples) override;
                 virtual bool        inline_display(plug::ICanvas *cv, size_t width, size_t height) override;
                 virtual void        dump(dspu::IStateDumper *v) const override;
+
+            public:
+                /**
+                 * Take the snapshot of the generator stream, should be called between process() calls
+                 * @param index generator index
+                 * @param s snapshot to fill
+                 * @return false if the generator is not in the deterministic seeding mode or plays
+                 *   back the noise table
+                 */
+                bool                snapshot(size_t index, snapshot_t *s) const;
+
+                /**
+                 * Restore the generator stream from the snapshot, should be called between process() calls.
+                 * The engine of the generator is re-created and the stream is replayed up to the
+                 * position of the snapshot, so the call may take a while.
+                 * @param index generator index
+                 * @param s snapshot to restore
+                 * @return false if the snapshot can not be restored
+                 */
+                bool                restore(size_t index, const snapshot_t *s);
+
+                /**
+                 * Estimate the memory allocated by the plugin instance, including buffers, noise
+                 * tables and the analyzer. Should be called between process() calls
+                 * @return number of bytes
+                 */
+                size_t              memory_footprint() const;
+
+                /**
+                 * Set the number of samples passed through generators, channels and the analyzer
+                 * at once. Small tiles keep the buffers in the L1 cache, the large blocks rendered
+                 * in parallel are not split. Should be called between process() calls
+                 * @param size tile size in samples, 0 to process whole blocks
+                 */
+                void                set_tile_size(size_t size);
         };
 
     } /* namespace plugins */
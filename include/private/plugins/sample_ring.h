@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_PLUGINS_SAMPLE_RING_H_
+#define PRIVATE_PLUGINS_SAMPLE_RING_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Lock-free ring buffer which passes several synchronous lanes of samples from
+         * a single producer thread to a single consumer thread. The producer never waits:
+         * samples which do not fit into the ring are dropped.
+         */
+        class sample_ring
+        {
+            private:
+                sample_ring & operator = (const sample_ring &);
+                sample_ring (const sample_ring &);
+
+            protected:
+                size_t              nLanes;             // Number of lanes
+                size_t              nCapacity;          // Capacity of each lane, power of 2
+                uatomic_t           nHead;              // Number of samples written by the producer
+                uatomic_t           nTail;              // Number of samples read by the consumer
+                uatomic_t           nDropped;           // Number of samples dropped by the producer
+                float             **vLanes;             // Data of each lane
+                uint8_t            *pData;              // Allocated data
+
+            public:
+                explicit sample_ring();
+                ~sample_ring();
+
+                void                construct();
+                void                destroy();
+
+                /**
+                 * Initialize the ring
+                 * @param lanes number of lanes
+                 * @param capacity minimum capacity of each lane in samples
+                 * @return true on success
+                 */
+                bool                init(size_t lanes, size_t capacity);
+
+            public:
+                /**
+                 * Drop all pending samples, should not be called while the consumer is active
+                 */
+                void                clear();
+
+                /**
+                 * Get the number of samples pending for the consumer
+                 * @return number of pending samples
+                 */
+                size_t              pending() const;
+
+                /**
+                 * Get the number of bytes allocated by the ring
+                 * @return number of allocated bytes
+                 */
+                size_t              footprint() const;
+
+                /**
+                 * Write samples, called by the producer only
+                 * @param src source buffer for each lane
+                 * @param count number of samples
+                 * @return number of samples written, the rest are dropped
+                 */
+                size_t              push(const float * const *src, size_t count);
+
+                /**
+                 * Read samples, called by the consumer only
+                 * @param dst destination buffer for each lane
+                 * @param count maximum number of samples
+                 * @return number of samples read
+                 */
+                size_t              pop(float * const *dst, size_t count);
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(dspu::IStateDumper *v) const;
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_PLUGINS_SAMPLE_RING_H_ */
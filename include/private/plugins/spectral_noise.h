@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PLUGINS_SPECTRAL_NOISE_H_
+#define PRIVATE_PLUGINS_SPECTRAL_NOISE_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/filters/SpectralTilt.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/util/Randomizer.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Noise generator that synthesizes coloured noise in the frequency domain.
+         * Each frame is a complex gaussian spectrum shaped by the target magnitude,
+         * the frames are converted with inverse FFT and joined with overlap-add using
+         * sine window. The cost of synthesis does not depend on the slope of the spectrum.
+         */
+        class spectral_noise
+        {
+            private:
+                spectral_noise & operator = (const spectral_noise &);
+                spectral_noise (const spectral_noise &);
+
+            protected:
+                dspu::Randomizer    sRand;              // Random number generator
+                size_t              nSampleRate;        // Sample rate
+                size_t              nRank;              // FFT rank
+                size_t              nOffset;            // Read offset in the output buffer
+                float               fSlope;             // Spectral slope [Np/Np]
+                float               fAmplitude;         // Amplitude
+                float               fOffset;            // Offset
+                float               fFftNorm;           // Normalizing factor of the inverse FFT
+                float               fChartGain;         // Gain of the frequency chart relative to white noise of the same power
+                bool                bSpare;             // The imaginary part contains the next frame
+                bool                bUpdate;            // Magnitude needs to be recomputed
+
+                float              *vMag;               // Magnitude of each spectral bin
+                float              *vWindow;            // Synthesis window
+                float              *vRe;                // Real part of the frame
+                float              *vIm;                // Imaginary part of the frame
+                float              *vOverlap;           // Overlap buffer
+                float              *vOut;               // Output buffer
+                uint8_t            *pData;              // Allocated data
+
+            protected:
+                void                update_magnitude();
+                void                synthesize_frame();
+                void                synthesize_block();
+
+            public:
+                explicit spectral_noise();
+                ~spectral_noise();
+
+                void                construct();
+                void                destroy();
+
+                /**
+                 * Initialize the generator
+                 * @param rank FFT rank
+                 * @param seed seed for the random number generator
+                 * @return true on success
+                 */
+                bool                init(size_t rank, uint32_t seed);
+
+                /**
+                 * Start the stream again with another seed, does not allocate memory
+                 * @param seed seed for the random number generator
+                 */
+                void                reseed(uint32_t seed);
+
+            public:
+                /**
+                 * Set sample rate
+                 * @param sr sample rate
+                 */
+                void                set_sample_rate(size_t sr);
+
+                /**
+                 * Set slope of the spectrum
+                 * @param slope slope value
+                 * @param unit slope unit
+                 */
+                void                set_slope(float slope, dspu::stlt_slope_unit_t unit);
+
+                /**
+                 * Set amplitude of the noise: the noise has the same power as uniform
+                 * white noise with the same amplitude
+                 * @param amplitude amplitude
+                 */
+                void                set_amplitude(float amplitude);
+
+                /**
+                 * Set offset of the noise
+                 * @param offset offset
+                 */
+                void                set_offset(float offset);
+
+                /**
+                 * Get the FFT frame size
+                 * @return FFT frame size in samples
+                 */
+                inline size_t       frame_size() const  { return 1 << nRank; }
+
+            public:
+                /**
+                 * Generate noise
+                 * @param dst destination buffer
+                 * @param count number of samples to generate
+                 */
+                void                process_overwrite(float *dst, size_t count);
+
+                /**
+                 * Compute the magnitude of the spectrum, normalized to 0 dB at 1 kHz
+                 * @param dst destination buffer to store magnitude
+                 * @param f list of frequencies
+                 * @param count number of frequencies
+                 */
+                void                freq_chart(float *dst, const float *f, size_t count) const;
+
+                /**
+                 * Get the gain which converts the frequency chart into the spectral density relative
+                 * to the density of uniform white noise with the same amplitude, valid after
+                 * the noise has been generated with the current settings
+                 * @return gain of the frequency chart
+                 */
+                inline float        chart_gain() const  { return fChartGain; }
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(dspu::IStateDumper *v) const;
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_PLUGINS_SPECTRAL_NOISE_H_ */
@@ -45,6 +45,31 @@ $x4     =   strpos($PAGE, '_x4') > 0;
 		<b>FFT GEN</b> - This control allows to plot the FFT of noise generator output. Use the channel buttons
 		to the left of this control to select which channels to plot.
 	</li>
+	<li>
+		<b>Analytic</b> - Draw the expected spectrum of generators computed from the frequency chart and the power
+		of the noise instead of the FFT analysis of their output. It saves the CPU time spent on the analysis.
+		Velvet noise and inaudible noise are always analyzed with FFT.
+	</li>
+	<li>
+		<b>FFT Thread</b> - Run the spectrum analysis on a background thread. The audio thread only passes
+		the samples to the analysis thread, so the FFT does not take the processing time of the audio thread.
+	</li>
+	<li>
+		<b>Parallel</b> - Render generators and channels in parallel on several CPU cores. It helps when the
+		host processes audio in large blocks, for example during offline rendering. Small blocks are always
+		processed on the audio thread only.
+	</li>
+	<li>
+		<b>DSP Load</b> - Enables measurement of the processing time and shows the share of the real-time
+		duration of each block spent by the plugin. The load of each generator and channel is also available
+		as an output meter. The measurement takes some extra time itself, so it is off by default.
+	</li>
+	<li>
+		<b>Seed</b> - Enables the deterministic seeding mode and sets the global seed. In this mode the output of each
+		generator depends only on the global seed, the seed and the settings of the generator, so the same
+		settings always produce the same noise. The noise starts from the beginning each time the seed or the noise type
+		of the generator change, other settings are applied without restarting the noise. When the mode is off, the generators are seeded randomly at startup.
+	</li>
 </ul>
 
 <p><b>'Signal' section:</b></p>
@@ -103,6 +128,28 @@ $x4     =   strpos($PAGE, '_x4') > 0;
 			frequency at 24 kHz. For this to work the sample rate must be higher than 48 kHz. For sample
 			rates lower than this the noise cannot be made inaudible.
 		</li>
+		<li>
+			<b>Inaudible filter</b> - The high pass filter used to make the noise inaudible. Available filters are below.
+		</li>
+		<ul>
+			<li><b>Butterworth</b> - 64th order Butterworth filter with cutoff frequency at 24 kHz.</li>
+			<li>
+				<b>Chebyshev</b> - 16th order inverse Chebyshev filter with 100 dB rejection of the band below 20 kHz.
+				It provides the same rejection of the audible band at much lower CPU cost.
+			</li>
+		</ul>
+		<li>
+			<b>Cached</b> - Pre-render the output of the generator into the noise table and play the table back
+			instead of generating the noise in real time. The table is rendered in background each time the settings
+			of the generator change. Playback picks up segments of the table at random positions and crossfades between
+			them, so the CPU cost does not depend on the type, color and filtering of the noise.
+		</li>
+		<li>
+			<b>Cache length</b> - The length of the noise table, in seconds.
+		</li>
+		<li>
+			<b>Seed</b> - The seed of the generator, used in the deterministic seeding mode only.
+		</li>
 	</ul>
 	<li><b>Type</b> - This control selects the type of noise generator. The following types are available.</li>
 	<ul>
@@ -125,6 +172,16 @@ $x4     =   strpos($PAGE, '_x4') > 0;
 			depending on the outcome of a random variable. This process can be tuned by a probability
 			to which the random variable is compared.
 		</li>
+		<li>
+			<b>Spectral</b> - Gaussian noise synthesized directly in the frequency domain. The spectrum
+			of the noise is shaped by the <b>Color</b> setting without any filtering, so the cost of this
+			generator does not depend on the color and the spectral slope is exact over the whole audio band.
+		</li>
+		<li>
+			<b>Counter</b> - Noise generator based on the counter-based random number generator. Each sample
+			depends only on the seed and its position in the stream, so there is no dependency between samples
+			and many of them are computed at once. It supports the same distributions as <b>LCG</b>.
+		</li>
 	</ul>
 	<li><b>Color</b> - Color of the noise. The following colors are available:</li>
 	<ul>
@@ -148,7 +205,7 @@ $x4     =   strpos($PAGE, '_x4') > 0;
 	</ul>
 	<li><b>Cstm</b> - Custom color value. Only active for custom colors. See <b>Color</b>.</li>
 	<li>
-		<b>Distribution</b> - Statistical distribution. Applies only to <b>LCG</b> noise. See <b>Type</b>.
+		<b>Distribution</b> - Statistical distribution. Applies only to <b>LCG</b> and <b>Counter</b> noise. See <b>Type</b>.
 		The distributions below are available.
 	</li>
 	<ul>
@@ -26,7 +26,7 @@
 
 #define LSP_PLUGINS_NOISE_GENERATOR_VERSION_MAJOR       1
 #define LSP_PLUGINS_NOISE_GENERATOR_VERSION_MINOR       0
-#define LSP_PLUGINS_NOISE_GENERATOR_VERSION_MICRO       26
+#define LSP_PLUGINS_NOISE_GENERATOR_VERSION_MICRO       27
 
 #define LSP_PLUGINS_NOISE_GENERATOR_VERSION  \
     LSP_MODULE_VERSION( \
@@ -62,12 +62,21 @@ namespace lsp
             { NULL,                             NULL }
         };
 
+        static const port_item_t noise_ina_filter[] =
+        {
+            { "Butterworth",                    "noise_generator.ina.butterworth" },
+            { "Chebyshev",                      "noise_generator.ina.chebyshev" },
+            { NULL,                             NULL }
+        };
+
         static const port_item_t noise_type[] =
         {
             { "off",                            "noise_generator.type.off" },
             { "MLS",                            "noise_generator.type.mls" },
             { "LCG",                            "noise_generator.type.lcg" },
             { "VELVET",                         "noise_generator.type.velvet" },
+            { "Spectral",                       "noise_generator.type.spectral" },
+            { "Counter",                        "noise_generator.type.counter" },
             { NULL,                             NULL }
         };
 
@@ -118,7 +127,11 @@ namespace lsp
             CONTROL("no" id, "Noise Offset" label, "Offset" label, U_NONE, noise_generator::NOISE_OFFSET), \
             SWITCH("ns" id, "Noise Solo" label, "Solo" label, 0.0f), \
             SWITCH("nm" id, "Noise Mute" label, "Mute" label, 0.0f), \
-            SWITCH("ni" id, "Noise Inaudible", "Inaudible" label, 0.0f)
+            SWITCH("ni" id, "Noise Inaudible", "Inaudible" label, 0.0f), \
+            COMBO("nif" id, "Noise Inaudible Filter" label, "Ina filter" label, noise_generator::NOISE_INA_DFL, noise_ina_filter), \
+            SWITCH("nch" id, "Noise Cached" label, "Cached" label, 0.0f), \
+            CONTROL("ncl" id, "Noise Cache Length" label, "Cache len" label, U_SEC, noise_generator::CACHE_LENGTH), \
+            INT_CONTROL("sd" id, "Noise Seed" label, "Seed" label, U_NONE, noise_generator::SEED)
 
         #define GENERATOR_CONTROLS(id, label, noise_t) \
             NOISE_CONTROLS(id, label, noise_t), \
@@ -127,6 +140,7 @@ namespace lsp
             COLOR_CONTROLS(id, label), \
             SWITCH("fftg" id, "Generator Output FFT Analysis" label, "FFT On " label, 1), \
             METER_GAIN("nlm" id, "Noise Level Meter" label, GAIN_AMP_P_24_DB), \
+            METER("nld" id, "Noise DSP Load" label, U_PERCENT, noise_generator::DSP_LOAD), \
             MESH("nsc" id, "Noise Spectrum Chart" label, 2, noise_generator::MESH_POINTS + 4), \
             MESH("nsg" id, "Noise Spectrum Graph" label, 2, noise_generator::MESH_POINTS)
 
@@ -140,6 +154,7 @@ namespace lsp
             AMP_GAIN100("gout" id, "Output gain" label, "Out gain" label, GAIN_AMP_0_DB), \
             METER_GAIN("ilm" id, "Input Level Meter" label, GAIN_AMP_P_24_DB), \
             METER_GAIN("olm" id, "Output Level Meter" label, GAIN_AMP_P_24_DB), \
+            METER("cld" id, "Channel DSP Load" label, U_PERCENT, noise_generator::DSP_LOAD), \
             MESH("isg" id, "Input Spectrum Graph" label, 2, noise_generator::MESH_POINTS), \
             MESH("osg" id, "Output Spectrum Graph" label, 2, noise_generator::MESH_POINTS)
 
@@ -159,7 +174,14 @@ namespace lsp
             SWITCH("ffto", "Output Signal FFT Analysis", "FFT Out", 0.0f), \
             SWITCH("fftg", "Generator Output Signal FFT Analysis", "FFT Gen", 1.0f), \
             LOG_CONTROL("react", "FFT Reactivity", "Reactivity", U_MSEC, noise_generator::FFT_REACT_TIME), \
-            AMP_GAIN("shift", "FFT Shift Gain", "FFT shift", 1.0f, 100.0f) \
+            AMP_GAIN("shift", "FFT Shift Gain", "FFT shift", 1.0f, 100.0f), \
+            SWITCH("fftbg", "FFT analysis on background thread", "FFT BG", 0.0f), \
+            SWITCH("ffta", "Analytic generator spectrum", "FFT Analytic", 0.0f), \
+            SWITCH("par", "Parallel rendering", "Parallel", 0.0f), \
+            SWITCH("dsd", "Deterministic seeding", "Determ seed", 0.0f), \
+            INT_CONTROL("seed", "Global seed", "Seed", U_NONE, noise_generator::SEED), \
+            SWITCH("dspm", "DSP load measurement", "DSP load", 0.0f), \
+            METER("dspl", "DSP load", U_PERCENT, noise_generator::DSP_LOAD) \
 
         static const port_t noise_generator_x1_ports[] =
         {
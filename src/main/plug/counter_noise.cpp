@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp/dsp.h>
+
+#include <private/plugins/counter_noise.h>
+#include <private/plugins/noise_dist.h>
+
+#define PHILOX_M0                   0xd2511f53U     // Multiplier of the first word
+#define PHILOX_M1                   0xcd9e8d57U     // Multiplier of the third word
+#define PHILOX_W0                   0x9e3779b9U     // Key increment of the first word, golden ratio
+#define PHILOX_W1                   0xbb67ae85U     // Key increment of the second word, sqrt(3) - 1
+#define PHILOX_ROUNDS               10
+#define PHILOX_KEY1                 0x243f6a88U     // Second word of the key, fraction of pi
+
+namespace lsp
+{
+    namespace plugins
+    {
+        counter_noise::counter_noise()
+        {
+            construct();
+        }
+
+        counter_noise::~counter_noise()
+        {
+            destroy();
+        }
+
+        void counter_noise::construct()
+        {
+            vKey[0]         = 0;
+            vKey[1]         = PHILOX_KEY1;
+            nPosition       = 0;
+            enDist          = dspu::LCG_UNIFORM;
+            fAmplitude      = 1.0f;
+            fOffset         = 0.0f;
+        }
+
+        void counter_noise::destroy()
+        {
+        }
+
+        void counter_noise::init(uint32_t seed)
+        {
+            vKey[0]         = seed;
+            vKey[1]         = PHILOX_KEY1;
+            nPosition       = 0;
+        }
+
+        void counter_noise::set_distribution(dspu::lcg_dist_t dist)
+        {
+            enDist          = dist;
+        }
+
+        void counter_noise::set_amplitude(float amplitude)
+        {
+            fAmplitude      = amplitude;
+        }
+
+        void counter_noise::set_offset(float offset)
+        {
+            fOffset         = offset;
+        }
+
+        void counter_noise::generate_raw(wsize_t counter, size_t count)
+        {
+            // Lanes are stored as structure of arrays so that every round is a
+            // simple loop over all counters which is well vectorized by the compiler
+            uint32_t c0[BLOCK_SIZE / LANES], c1[BLOCK_SIZE / LANES];
+            uint32_t c2[BLOCK_SIZE / LANES], c3[BLOCK_SIZE / LANES];
+
+            for (size_t i=0; i<count; ++i)
+            {
+                const wsize_t c     = counter + i;
+                c0[i]               = uint32_t(c);
+                c1[i]               = uint32_t(c >> 32);
+                c2[i]               = 0;
+                c3[i]               = 0;
+            }
+
+            uint32_t k0         = vKey[0];
+            uint32_t k1         = vKey[1];
+            for (size_t r=0; r<PHILOX_ROUNDS; ++r)
+            {
+                for (size_t i=0; i<count; ++i)
+                {
+                    const uint64_t p0   = uint64_t(PHILOX_M0) * c0[i];
+                    const uint64_t p1   = uint64_t(PHILOX_M1) * c2[i];
+                    c0[i]               = uint32_t(p1 >> 32) ^ c1[i] ^ k0;
+                    c1[i]               = uint32_t(p1);
+                    c2[i]               = uint32_t(p0 >> 32) ^ c3[i] ^ k1;
+                    c3[i]               = uint32_t(p0);
+                }
+                k0                 += PHILOX_W0;
+                k1                 += PHILOX_W1;
+            }
+
+            uint32_t *dst       = vRaw;
+            for (size_t i=0; i<count; ++i, dst += LANES)
+            {
+                dst[0]              = c0[i];
+                dst[1]              = c1[i];
+                dst[2]              = c2[i];
+                dst[3]              = c3[i];
+            }
+        }
+
+        void counter_noise::map_distribution(size_t count)
+        {
+            switch (enDist)
+            {
+                case dspu::LCG_EXPONENTIAL:
+                    noise_dist::exponential(vOut, vRaw, count);
+                    break;
+                case dspu::LCG_TRIANGULAR:
+                    noise_dist::triangular(vOut, vRaw, count);
+                    break;
+                case dspu::LCG_GAUSSIAN:
+                    noise_dist::gaussian(vOut, vRaw, count);
+                    break;
+                case dspu::LCG_UNIFORM:
+                default:
+                    noise_dist::uniform(vOut, vRaw, count);
+                    break;
+            }
+        }
+
+        void counter_noise::process_overwrite(float *dst, size_t count)
+        {
+            while (count > 0)
+            {
+                // Compute the whole groups covering the requested range, the distribution
+                // transforms are applied to the groups aligned to the stream position
+                const wsize_t first = nPosition & ~wsize_t(GROUP - 1);
+                const size_t skip   = nPosition - first;
+                const size_t to_do  = lsp_min(count, BLOCK_SIZE - skip);
+                const size_t groups = (skip + to_do + GROUP - 1) / GROUP;
+
+                generate_raw(first / LANES, groups * (GROUP / LANES));
+                map_distribution(groups * GROUP);
+                dsp::mul_k3(dst, &vOut[skip], fAmplitude, to_do);
+                if (fOffset != 0.0f)
+                    dsp::add_k2(dst, fOffset, to_do);
+
+                nPosition          += to_do;
+                dst                += to_do;
+                count              -= to_do;
+            }
+        }
+
+        void counter_noise::dump(dspu::IStateDumper *v) const
+        {
+            v->writev("vKey", vKey, 2);
+            v->write("nPosition", nPosition);
+            v->write("enDist", enDist);
+            v->write("fAmplitude", fAmplitude);
+            v->write("fOffset", fOffset);
+            v->write("vRaw", vRaw);
+            v->write("vOut", vOut);
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/runtime/system.h>
+
+#include <private/plugins/dsp_load.h>
+
+#define LOAD_MEAN_PERIODS           64  // Number of periods averaged by the running mean
+
+namespace lsp
+{
+    namespace plugins
+    {
+        static const float bucket_limits[] =
+        {
+            0.01f, 0.02f, 0.05f, 0.1f, 0.2f, 0.5f, 1.0f
+        };
+
+        dsp_load::dsp_load()
+        {
+            construct();
+        }
+
+        dsp_load::~dsp_load()
+        {
+            destroy();
+        }
+
+        void dsp_load::construct()
+        {
+            reset();
+        }
+
+        void dsp_load::destroy()
+        {
+        }
+
+        wsize_t dsp_load::timestamp()
+        {
+            system::time_t ts;
+            system::get_time(&ts);
+            return wsize_t(ts.seconds) * 1000000000U + wsize_t(ts.nanos);
+        }
+
+        void dsp_load::reset()
+        {
+            nTime           = 0;
+            nPeriods        = 0;
+            fLast           = 0.0f;
+            fMean           = 0.0f;
+            fMax            = 0.0f;
+            for (size_t i=0; i<BUCKETS; ++i)
+                vHistogram[i]   = 0;
+        }
+
+        void dsp_load::commit(float period)
+        {
+            const float load    = (period > 0.0f) ? float(nTime) / period : 0.0f;
+            nTime               = 0;
+
+            // The mean is the plain average until enough periods are collected
+            ++nPeriods;
+            const float k       = 1.0f / lsp_min(nPeriods, wsize_t(LOAD_MEAN_PERIODS));
+            fLast               = load;
+            fMean              += (load - fMean) * k;
+            fMax                = lsp_max(fMax, load);
+
+            size_t bucket       = 0;
+            while ((bucket < BUCKETS - 1) && (load >= bucket_limits[bucket]))
+                ++bucket;
+            ++vHistogram[bucket];
+        }
+
+        void dsp_load::dump(dspu::IStateDumper *v) const
+        {
+            v->write("nTime", nTime);
+            v->write("nPeriods", nPeriods);
+            v->write("fLast", fLast);
+            v->write("fMean", fMean);
+            v->write("fMax", fMax);
+            v->writev("vHistogram", vHistogram, BUCKETS);
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
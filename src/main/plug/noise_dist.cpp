@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <private/plugins/noise_dist.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        namespace noise_dist
+        {
+            void uniform(float *dst, const uint32_t *src, size_t count)
+            {
+                for (size_t i=0; i<count; ++i)
+                    dst[i]          = float(int32_t(src[i])) * (1.0f / 2147483648.0f);
+            }
+
+            void exponential(float *dst, const uint32_t *src, size_t count)
+            {
+                // The variance of Laplace distribution with scale k is 2*k^2
+                const float k       = 0.40824829f;                          // 1/sqrt(6)
+                for (size_t i=0; i<count; ++i)
+                {
+                    const uint32_t x    = src[i];
+                    const float u       = float((x >> 8) | 1) * (1.0f / 16777216.0f);
+                    const float v       = -fast_log(u) * k;
+                    dst[i]              = as_float(as_uint(v) ^ (x << 31)); // Lowest bit is the sign
+                }
+            }
+
+            void triangular(float *dst, const uint32_t *src, size_t count)
+            {
+                // The sum of two uniform numbers has half of the variance of uniform distribution
+                const float k       = 1.41421356f / 65536.0f;
+                for (size_t i=0; i<count; ++i)
+                {
+                    const uint32_t x    = src[i];
+                    dst[i]              = float(int32_t((x & 0xffff) + (x >> 16)) - 65535) * k;
+                }
+            }
+
+            void gaussian(float *dst, const uint32_t *src, size_t count)
+            {
+                // Random numbers are paired with a distance of 4 elements within groups of 8,
+                // so the pairs do not depend on the block size and each group is computed
+                // with a single vector operation per step
+                const float k       = -2.0f / 3.0f;                         // sigma^2 = 1/3
+                for (size_t i=0; i<count; i += 8)
+                {
+                    for (size_t j=0; j<4; ++j)
+                    {
+                        const float u1      = float((src[i+j] >> 8) | 1) * (1.0f / 16777216.0f);
+                        const float r       = fast_sqrt(k * fast_log(u1));
+
+                        // The angle is shifted by pi which just changes the sign of both
+                        // values and keeps the distribution
+                        const float h       = (float(src[i+j+4] >> 8) * (1.0f / 16777216.0f) - 0.5f) * float(M_PI);
+                        float s, c;
+                        fast_sincos(h, &s, &c);
+
+                        dst[i+j]            = r * c;
+                        dst[i+j+4]          = r * s;
+                    }
+                }
+            }
+
+        } /* namespace noise_dist */
+    } /* namespace plugins */
+} /* namespace lsp */
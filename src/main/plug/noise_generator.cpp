@@ -22,21 +22,53 @@
 #include <lsp-plug.in/common/alloc.h>
 #include <lsp-plug.in/common/debug.h>
 #include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/noise/LCG.h>
 #include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/ipc/Thread.h>
 #include <lsp-plug.in/plug-fw/meta/func.h>
 #include <lsp-plug.in/runtime/system.h>
 #include <lsp-plug.in/shared/id_colors.h>
 
+#include <stdlib.h>
+
 #include <private/meta/noise_generator.h>
 #include <private/plugins/noise_generator.h>
 
 /* The size of temporary buffer for audio processing */
 #define BUFFER_SIZE                 0x1000U
+#define BUFFER_SIZE_DFL             0x400U // Size of temporary buffer until the block length of the host is known
+#define TILE_SIZE_DFL               0x100U // Number of samples passed through all processing stages at once
 #define INA_FILTER_ORD              64
 #define INA_FILTER_CUTOFF           (DEFAULT_SAMPLE_RATE * 0.5f)
+#define INA_CHEB_ORD                16
+#define INA_CHEB_STOP               20000.0f // End of the audible band, the stop band of the Chebyshev filter
+#define INA_CHEB_REJECTION          100.0f // Stop band rejection of the Chebyshev filter [dB]
 #define INA_ATTENUATION             0.5f // We attenuate the noise before filtering to make it inaudible. This to prevent sharp transients from still being audible.
 #define COLOR_FILTER_ORDER          32
+#define SPECTRAL_RANK               12   // FFT rank of the spectral noise generator
+#define SPARSE_DENSITY              8    // Minimum ratio between block length and number of impulses to treat output as sparse
 #define IDISPLAY_BUF_SIZE           64u  // Number of samples in frequency chart for Inline Display
+#define BYPASS_SETTLE_TIME          0.05f // Time to wait until the bypass crossfade completes, well above the dspu::Bypass default
+#define CACHE_SEGMENT_TIME          0.25f // Length of the segment played from a random position of the noise table
+#define CACHE_XFADE                 256u // Number of samples to crossfade between segments of the noise table
+#define PARALLEL_MIN_BLOCK          1024u // Minimum block size to render generators and channels in parallel
+#define WORKER_SPIN_COUNT           0x4000 // Number of polls of the idle worker before going to sleep
+#define JOB_SPIN_COUNT              0x4000 // Number of polls of the audio thread before it yields the CPU to workers
+#define JOB_CLOCK_PERIOD            0x100 // Number of polls of the audio thread between checks of the deadline of jobs
+#define PARALLEL_BACKOFF            1.0f // Time of serial rendering after a worker has missed the deadline [s]
+#define WORKER_SLEEP_ACTIVE         1    // Sleep time of the idle worker when parallel rendering is on [ms]
+#define WORKER_SLEEP_IDLE           50   // Sleep time of the idle worker when parallel rendering is off [ms]
+#define TASK_WAIT_PERIOD            10   // Period of polling the state of the task submitted to the executor [ms]
+#define TASK_WAIT_TIMEOUT           2000 // Maximum time to wait for the task submitted to the executor on destroy [ms]
+#define MAX_JOBS                    (meta::noise_generator::NUM_GENERATORS + meta::noise_generator::CHANNELS_MAX)
+#define MAX_AN_CHANNELS             (meta::noise_generator::CHANNELS_MAX * 2 + meta::noise_generator::NUM_GENERATORS)
+#define ANALYSIS_RING_SIZE          0x8000U // Capacity of the ring passing samples to the analysis thread
+#define ANALYSIS_BLOCK_SIZE         0x400U // Maximum number of samples taken from the ring by the analysis thread at once
+#define ANALYSIS_SLEEP              5    // Sleep time of the analysis thread when there are no samples [ms]
+#define ANALYSIS_FRESH              0x4U // Flag of the published spectrum slot which has not been read yet
+#define CHART_FRESH                 0x4U // Flag of the published chart frame which has not been read yet
+#define LCG_SIGMA_SAMPLES           0x10000U // Number of samples used to measure the deviation of each LCG distribution
+#define CHART_CACHE_SIZE            (meta::noise_generator::NUM_GENERATORS * 2) // Number of cached frequency charts
 
 namespace lsp
 {
@@ -46,6 +78,28 @@ namespace lsp
         return p;
     }
 
+    // Hint the CPU that the thread is polling a shared variable
+    static inline void cpu_relax()
+    {
+    #if defined(ARCH_X86)
+        __asm__ __volatile__ ("pause");
+    #elif defined(ARCH_AARCH64)
+        __asm__ __volatile__ ("yield");
+    #endif
+    }
+
+    // Wait until the task submitted to the executor completes, false if the executor did not complete it in time
+    static bool wait_task(ipc::ITask *task, size_t timeout)
+    {
+        for (size_t t = 0; (task->submitted()) || (task->running()); t += TASK_WAIT_PERIOD)
+        {
+            if (t >= timeout)
+                return false;
+            ipc::Thread::sleep(TASK_WAIT_PERIOD);
+        }
+        return true;
+    }
+
     namespace plugins
     {
         //---------------------------------------------------------------------
@@ -81,11 +135,44 @@ namespace lsp
 
                 g->fGain            = 0.0f;
                 g->bActive          = false;
-                g->bInaudible       = false;
                 g->bUpdPlots        = true;
+                g->bSyncChart       = false;
+                g->bAnalytic        = false;
+                g->fSigma           = 0.0f;
+                g->bFrozen          = false;
+                g->bValid           = false;
+                g->fLevel           = GAIN_AMP_M_INF_DB;
+                g->bSparse          = false;
+                g->nImpulses        = -1;
+                g->nConsumers       = 0;
+                g->nUpdate          = UPD_NOISE_ALL;
+                g->nSeed            = 0;
+                g->nPosition        = 0;
+
+                g->pEngine          = &g->vEngines[0];
+                g->pStandby         = &g->vEngines[1];
+                g->bStandby         = false;
+                g->bRendered        = false;
+                g->bReseed          = false;
+                g->nReseed          = 0;
+
+                g->pCache           = NULL;
+                g->bCached          = false;
+                g->bCacheDirty      = false;
+                g->nCacheLength     = 0;
+                g->nCacheSize       = 0;
+                g->nCacheCap        = 0;
+                g->nCachePos        = 0;
+                g->nCacheLeft       = 0;
+                g->nFadePos         = 0;
+                g->nFadeDone        = CACHE_XFADE;
+                g->vCache           = NULL;
+                g->vFadeData        = NULL;
 
                 g->vBuffer          = NULL;
                 g->vFreqChart       = NULL;
+                g->vImpIdx          = NULL;
+                g->vImpAmp          = NULL;
 
                 g->pNoiseType       = NULL;
                 g->pAmplitude       = NULL;
@@ -93,6 +180,10 @@ namespace lsp
                 g->pSlSw            = NULL;
                 g->pMtSw            = NULL;
                 g->pInaSw           = NULL;
+                g->pInaFilter       = NULL;
+                g->pCached          = NULL;
+                g->pCacheLen        = NULL;
+                g->pSeed            = NULL;
                 g->pLCGdist         = NULL;
                 g->pVelvetType      = NULL;
                 g->pVelvetWin       = NULL;
@@ -105,6 +196,7 @@ namespace lsp
                 g->pCslopeDBD       = NULL;
                 g->pFft             = NULL;
                 g->pMeterOut        = NULL;
+                g->pLoad            = NULL;
                 g->pMsh             = NULL;
                 g->pSpectrum        = NULL;
             }
@@ -114,10 +206,110 @@ namespace lsp
             vFreqs          = NULL;
             vIndexes        = NULL;
             vFreqChart      = NULL;
+            for (size_t i=0; i<CHART_CACHE_SIZE; ++i)
+            {
+                chart_t *ch     = &vCharts[i];
+                ch->nAccess     = 0;
+                ch->bValid      = false;
+                ch->vData       = NULL;
+            }
+            nChartClock     = 0;
             fGainIn         = GAIN_AMP_0_DB;
             fGainOut        = GAIN_AMP_0_DB;
+            nBypassHold     = 0;
+            nCacheSegment   = 0;
+            vFadeIn         = NULL;
+            vFadeOut        = NULL;
+            bBypass         = true;
+            bParallel       = false;
+            bUIActive       = false;
+            bDirect         = false;
+            bSeeded         = false;
+            pExecutor       = NULL;
+            pLauncher       = NULL;
+            pAnalysis       = NULL;
+            nAnState        = AN_DIRECT;
+            nAnConfig       = 0;
+            nAnSwap         = 1;
+            nAnFront        = 0;
+            nAnBack         = 2;
+            nAnPeriod       = 0;
+            nAnFrame        = 0;
+            bAnThread       = false;
+            bAnDirty        = true;
+            bFftOn          = false;
+            bFftThread      = false;
+            for (size_t i=0; i<MAX_AN_CHANNELS; ++i)
+                vAnBuffers[i]   = NULL;
+            vAnSpectra      = NULL;
+            vAnEnvelope     = NULL;
+            fAnNorm         = 0.0f;
+            for (size_t i=0; i<dspu::LCG_MAX; ++i)
+                vLCGSigma[i]    = 0.0f;
+            sAnConfig.fReactivity   = meta::noise_generator::FFT_REACT_TIME_DFL;
+            sAnConfig.fShift        = 100.0f;
+            sAnConfig.bActive       = false;
+            for (size_t i=0; i<MAX_AN_CHANNELS; ++i)
+                sAnConfig.vEnabled[i]   = false;
+            sAnShared       = sAnConfig;
+            for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS - 1; ++i)
+                vWorkers[i]     = NULL;
+            nWorkers        = 0;
+            nLaunch         = 0;
+            nLaunched       = 0;
+            nEngineRequest  = 0;
+            bWorkers        = false;
+            nParallel       = 0;
+            nSerialHold     = 0;
+            bStalled        = false;
+            bSettingsPending= false;
+            for (size_t i=0; i<MAX_JOBS; ++i)
+            {
+                job_t *job      = &vJobs[i];
+                job->nState     = JOB_IDLE;
+                job->enType     = JOB_GENERATOR;
+                job->nIndex     = 0;
+                job->nSamples   = 0;
+            }
             pData           = NULL;
+            pBlockData      = NULL;
+            pAnData         = NULL;
+            nDataSize       = 0;
+            nBlockDataSize  = 0;
+            nAnDataSize     = 0;
+            nBlockSize      = 0;
+            nMaxBlock       = 0;
+            nBlockRequest   = 0;
+            pBlockGarbage   = NULL;
+            nTileSize       = TILE_SIZE_DFL;
+            bAnInit         = false;
+            bMeasure        = false;
             pIDisplay       = NULL;
+            vIDisplayIdx    = NULL;
+            nIDisplayGridX  = 0;
+            nIDisplayGridY  = 0;
+            nIDisplayWidth  = 0;
+            nIDisplayHeight = 0;
+            nIDisplayRate   = 0;
+            for (size_t i=0; i<3; ++i)
+            {
+                chart_frame_t *f    = &vChartFrames[i];
+                f->nVersion         = 0;
+                for (size_t j=0; j<meta::noise_generator::NUM_GENERATORS; ++j)
+                {
+                    f->vActive[j]       = false;
+                    f->vData[j]         = NULL;
+                }
+            }
+            nChartSwap      = 1;
+            nChartBack      = 2;
+            nChartFront     = 0;
+            nChartVersion   = 0;
+            nIDisplayVersion= 0;
+            pIDisplayCanvas = NULL;
+            bIDisplayBypass = false;
+            bIDisplayActive = false;
+            bIDisplayValid  = false;
 
             pBypass         = NULL;
             pGainIn         = NULL;
@@ -127,6 +319,13 @@ namespace lsp
             pFftGen         = NULL;
             pReactivity     = NULL;
             pShiftGain      = NULL;
+            pFftThread      = NULL;
+            pFftAnalytic    = NULL;
+            pParallel       = NULL;
+            pSeeded         = NULL;
+            pSeed           = NULL;
+            pMeasure        = NULL;
+            pLoad           = NULL;
         }
 
         noise_generator::~noise_generator()
@@ -134,13 +333,25 @@ namespace lsp
             do_destroy();
         }
 
-        ssize_t noise_generator::make_seed() const
+        ssize_t noise_generator::make_seed()
         {
             system::time_t ts;
             system::get_time(&ts);
             return ts.seconds ^ ts.nanos;
         }
 
+        uint32_t noise_generator::derive_seed(uint32_t seed, uint32_t salt)
+        {
+            // Finalizer of MurmurHash3: every bit of the input affects every bit of the output
+            uint32_t h  = seed ^ (salt * 0x9e3779b9U);
+            h          ^= h >> 16;
+            h          *= 0x85ebca6bU;
+            h          ^= h >> 13;
+            h          *= 0xc2b2ae35U;
+            h          ^= h >> 16;
+            return h;
+        }
+
         dspu::lcg_dist_t noise_generator::get_lcg_dist(size_t value)
         {
             switch (value)
@@ -223,89 +434,604 @@ namespace lsp
             }
         }
 
+        noise_generator::ina_filter_t noise_generator::get_ina_filter(size_t value)
+        {
+            switch (value)
+            {
+                case meta::noise_generator_metadata::NOISE_INA_CHEBYSHEV:
+                    return INA_FILTER_CHEBYSHEV;
+                case meta::noise_generator_metadata::NOISE_INA_BUTTERWORTH:
+                default:
+                    return INA_FILTER_BUTTERWORTH;
+            }
+        }
+
+        void noise_generator::design_audible_stop(dspu::FilterBank *fb, float sample_rate)
+        {
+            // Chebyshev type II high-pass filter: equiripple stop band below INA_CHEB_STOP with
+            // INA_CHEB_REJECTION attenuation and monotonic pass band. For the same rejection of the
+            // audible band it requires much lower order than the Butterworth filter.
+            // The poles of the high-pass filter are the poles of Chebyshev type I low-pass prototype
+            // scaled by the stop band edge, the zeros lie on the imaginary axis inside the stop band.
+            const double eps    = 1.0 / sqrt(pow(10.0, INA_CHEB_REJECTION * 0.1) - 1.0);
+            const double mu     = asinh(1.0 / eps) / INA_CHEB_ORD;
+            const double ws     = tan(M_PI * lsp_min(INA_CHEB_STOP, sample_rate * 0.49f) / sample_rate);
+            const double sh     = sinh(mu);
+            const double ch     = cosh(mu);
+
+            fb->begin();
+            for (size_t k=0; k < INA_CHEB_ORD/2; ++k)
+            {
+                dsp::biquad_x1_t *f = fb->add_chain();
+                if (f == NULL)
+                    break;
+
+                // Analog pole and zero
+                const double theta  = M_PI * (2*k + 1) / (2.0 * INA_CHEB_ORD);
+                const double re     = -ws * sh * sin(theta);
+                const double im     = ws * ch * cos(theta);
+                const double wz     = ws * cos(theta);
+
+                // Bilinear transform
+                const double d      = (1.0 - re)*(1.0 - re) + im*im;
+                const double a1     = 2.0 * (1.0 - re*re - im*im) / d;
+                const double a2     = -((1.0 + re)*(1.0 + re) + im*im) / d;
+                const double cz     = (1.0 - wz*wz) / (1.0 + wz*wz);
+
+                // Normalize to unit gain at Nyquist frequency
+                const double gain   = (1.0 + a1 - a2) / (2.0 + 2.0 * cz);
+
+                f->b0               = gain;
+                f->b1               = -2.0 * cz * gain;
+                f->b2               = gain;
+                f->a1               = a1;
+                f->a2               = a2;
+                f->p0               = 0.0f;
+                f->p1               = 0.0f;
+                f->p2               = 0.0f;
+            }
+            fb->end(true);
+        }
+
+        bool noise_generator::init_engine(engine_t *e, uint32_t seed)
+        {
+            // Construct in-place DSP processors
+            e->sNoiseGenerator.construct();
+            e->sAudibleStop.construct();
+            e->sAudibleStop.init();
+            e->sAudibleStopCheb.construct();
+            if (!e->sAudibleStopCheb.init(INA_CHEB_ORD/2))
+                return false;
+            e->sSpectral.construct();
+            if (!e->sSpectral.init(SPECTRAL_RANK, derive_seed(seed, 1)))
+                return false;
+            e->sCounter.construct();
+            reseed_engine(e, seed);
+            e->sCounterColor.construct();
+            e->sCounterColor.set_order(COLOR_FILTER_ORDER);
+
+            // We also set the inaudible noise filter main properties. These are not user configurable.
+            e->sAudibleStop.set_order(INA_FILTER_ORD);
+            e->sAudibleStop.set_filter_type(dspu::BW_FLT_TYPE_HIGHPASS);
+
+            // Same with colour
+            e->sNoiseGenerator.set_coloring_order(COLOR_FILTER_ORDER);
+
+            return true;
+        }
+
+        void noise_generator::reseed_engine(engine_t *e, uint32_t seed)
+        {
+            // We seed every noise generator differently so that they produce uncorrelated noise.
+            // We set the MLS number of bits to -1 so that the initialiser sets it to maximum.
+            // The state of MLS should never be zero.
+            e->sNoiseGenerator.init(
+                -1, derive_seed(seed, 2) | 1,
+                derive_seed(seed, 3),
+                derive_seed(seed, 4), -1, derive_seed(seed, 5) | 1);
+            e->sSpectral.reseed(derive_seed(seed, 1));
+            e->sCounter.init(derive_seed(seed, 7));
+            e->sAudibleStopCheb.reset();
+        }
+
+        void noise_generator::destroy_engine(engine_t *e)
+        {
+            e->sNoiseGenerator.destroy();
+            e->sAudibleStop.destroy();
+            e->sAudibleStopCheb.destroy();
+            e->sSpectral.destroy();
+            e->sCounter.destroy();
+            e->sCounterColor.destroy();
+        }
+
+        void noise_generator::update_engine_sample_rate(engine_t *e, size_t sr)
+        {
+            e->sNoiseGenerator.set_sample_rate(sr);
+            e->sAudibleStop.set_sample_rate(sr);
+            e->sAudibleStop.set_cutoff_frequency(INA_FILTER_CUTOFF);
+            design_audible_stop(&e->sAudibleStopCheb, sr);
+            e->sSpectral.set_sample_rate(sr);
+            e->sCounterColor.set_sample_rate(sr);
+        }
+
+        void noise_generator::configure_engine(engine_t *e, const gen_params_t *p, size_t flags)
+        {
+            // Apply only the changed settings: changing the colour redesigns the filters
+            if (flags & UPD_NOISE_TYPE)
+            {
+                e->sNoiseGenerator.set_lcg_distribution(p->enLCGDist);
+                e->sNoiseGenerator.set_velvet_type(p->enVelvetType);
+                e->sNoiseGenerator.set_velvet_window_width(p->fVelvetWin);
+                e->sNoiseGenerator.set_velvet_arn_delta(p->fVelvetARNd);
+                e->sNoiseGenerator.set_velvet_crush(p->bVelvetCrush);
+                e->sNoiseGenerator.set_velvet_crushing_probability(p->fVelvetCrushProb);
+                e->sCounter.set_distribution(p->enLCGDist);
+
+                switch (p->nType)
+                {
+                    case meta::noise_generator_metadata::NOISE_TYPE_MLS:
+                        e->sNoiseGenerator.set_generator(dspu::NG_GEN_MLS);
+                        break;
+                    case meta::noise_generator_metadata::NOISE_TYPE_VELVET:
+                        e->sNoiseGenerator.set_generator(dspu::NG_GEN_VELVET);
+                        break;
+                    case meta::noise_generator_metadata::NOISE_TYPE_LCG:
+                    case meta::noise_generator_metadata::NOISE_TYPE_SPECTRAL:
+                    case meta::noise_generator_metadata::NOISE_TYPE_COUNTER:
+                    case meta::noise_generator_metadata::NOISE_TYPE_OFF:
+                    default:
+                        e->sNoiseGenerator.set_generator(dspu::NG_GEN_LCG);
+                        break;
+                }
+            }
+
+            if (flags & UPD_NOISE_COLOR)
+            {
+                e->sNoiseGenerator.set_noise_color(p->enColor);
+                e->sNoiseGenerator.set_color_slope(p->fSlope, p->enSlopeUnit);
+
+                // The spectral and counter-based generators follow the same colour settings
+                float spectral_slope    = 0.0f;
+                dspu::stlt_slope_unit_t spectral_slope_unit = dspu::STLT_SLOPE_UNIT_NEPER_PER_NEPER;
+                switch (p->enColor)
+                {
+                    case dspu::NG_COLOR_PINK:       spectral_slope = -0.5f; break;
+                    case dspu::NG_COLOR_RED:        spectral_slope = -1.0f; break;
+                    case dspu::NG_COLOR_BLUE:       spectral_slope = 0.5f;  break;
+                    case dspu::NG_COLOR_VIOLET:     spectral_slope = 1.0f;  break;
+                    case dspu::NG_COLOR_ARBITRARY:
+                        spectral_slope          = p->fSlope;
+                        spectral_slope_unit     = p->enSlopeUnit;
+                        break;
+                    case dspu::NG_COLOR_WHITE:
+                    default:
+                        break;
+                }
+                e->sSpectral.set_slope(spectral_slope, spectral_slope_unit);
+                e->sCounterColor.set_slope(spectral_slope, spectral_slope_unit);
+            }
+
+            if (flags & UPD_NOISE_AMPLITUDE)
+            {
+                e->sNoiseGenerator.set_amplitude(p->fAmplitude);
+                e->sSpectral.set_amplitude(p->fAmplitude);
+                e->sCounter.set_amplitude(p->fAmplitude);
+            }
+
+            // The offset of the counter-based generator is applied after colouring
+            if (flags & (UPD_NOISE_OFFSET | UPD_NOISE_COLOR))
+            {
+                e->sNoiseGenerator.set_offset(p->fOffset);
+                e->sSpectral.set_offset(p->fOffset);
+                e->sCounter.set_offset((p->enColor == dspu::NG_COLOR_WHITE) ? p->fOffset : 0.0f);
+            }
+        }
+
+        void noise_generator::render_engine(engine_t *e, const gen_params_t *p, float *dst, size_t samples)
+        {
+            generate_engine(e, p, dst, samples);
+            filter_engine(e, p, dst, samples);
+        }
+
+        void noise_generator::generate_engine(engine_t *e, const gen_params_t *p, float *dst, size_t samples)
+        {
+            switch (p->nType)
+            {
+                case meta::noise_generator_metadata::NOISE_TYPE_SPECTRAL:
+                    e->sSpectral.process_overwrite(dst, samples);
+                    break;
+                case meta::noise_generator_metadata::NOISE_TYPE_COUNTER:
+                    e->sCounter.process_overwrite(dst, samples);
+                    if (p->enColor != dspu::NG_COLOR_WHITE)
+                    {
+                        e->sCounterColor.process_overwrite(dst, dst, samples);
+                        if (p->fOffset != 0.0f)
+                            dsp::add_k2(dst, p->fOffset, samples);
+                    }
+                    break;
+                default:
+                    e->sNoiseGenerator.process_overwrite(dst, samples);
+                    break;
+            }
+        }
+
+        void noise_generator::filter_engine(engine_t *e, const gen_params_t *p, float *dst, size_t samples)
+        {
+            if (p->bInaudible)
+            {
+                dsp::mul_k2(dst, INA_ATTENUATION, samples);
+                if (p->enInaFilter == INA_FILTER_CHEBYSHEV)
+                    e->sAudibleStopCheb.process(dst, dst, samples);
+                else
+                    e->sAudibleStop.process_overwrite(dst, dst, samples);
+            }
+        }
+
+        size_t noise_generator::params_changes(const gen_params_t *a, const gen_params_t *b)
+        {
+            size_t flags    = 0;
+
+            if ((a->nType != b->nType) ||
+                (a->enLCGDist != b->enLCGDist) ||
+                (a->enVelvetType != b->enVelvetType) ||
+                (a->fVelvetWin != b->fVelvetWin) ||
+                (a->fVelvetARNd != b->fVelvetARNd) ||
+                (a->bVelvetCrush != b->bVelvetCrush) ||
+                (a->fVelvetCrushProb != b->fVelvetCrushProb))
+                flags          |= UPD_NOISE_TYPE;
+
+            // The slope matters for the arbitrary colour only
+            if ((a->enColor != b->enColor) ||
+                ((a->enColor == dspu::NG_COLOR_ARBITRARY) &&
+                 ((a->enSlopeUnit != b->enSlopeUnit) || (a->fSlope != b->fSlope))))
+                flags          |= UPD_NOISE_COLOR;
+
+            if (a->fAmplitude != b->fAmplitude)
+                flags          |= UPD_NOISE_AMPLITUDE;
+            if (a->fOffset != b->fOffset)
+                flags          |= UPD_NOISE_OFFSET;
+            if ((a->bInaudible != b->bInaudible) || (a->enInaFilter != b->enInaFilter))
+                flags          |= UPD_NOISE_INAUDIBLE;
+
+            return flags;
+        }
+
+        //---------------------------------------------------------------------
+        noise_generator::CacheRenderer::CacheRenderer()
+        {
+            nSampleRate     = 0;
+            nSeed           = 0;
+            nLength         = 0;
+            nCapacity       = 0;
+            vData           = NULL;
+        }
+
+        noise_generator::CacheRenderer::~CacheRenderer()
+        {
+            if (vData != NULL)
+            {
+                free(vData);
+                vData           = NULL;
+            }
+            nCapacity       = 0;
+        }
+
+        status_t noise_generator::CacheRenderer::run()
+        {
+            // Grow the table if needed
+            if (nLength > nCapacity)
+            {
+                float *ptr      = static_cast<float *>(realloc(vData, nLength * sizeof(float)));
+                if (ptr == NULL)
+                    return STATUS_NO_MEM;
+                vData           = ptr;
+                nCapacity       = nLength;
+            }
+
+            // Re-create the engine so that the table depends only on the seed and the settings
+            destroy_engine(&sEngine);
+            if (!init_engine(&sEngine, nSeed))
+                return STATUS_NO_MEM;
+
+            // Render the fully processed output of the generator
+            update_engine_sample_rate(&sEngine, nSampleRate);
+            configure_engine(&sEngine, &sParams, UPD_NOISE_ALL);
+            render_engine(&sEngine, &sParams, vData, nLength);
+
+            return STATUS_OK;
+        }
+
+        //---------------------------------------------------------------------
+        noise_generator::Launcher::Launcher(noise_generator *core)
+        {
+            pCore           = core;
+            nState          = LS_READY;
+            nRequest        = 0;
+            nDone           = 0;
+            pAnalysis       = NULL;
+            sBlock.pData    = NULL;
+            sBlock.pPtr     = NULL;
+            sBlock.nSize    = 0;
+            sBlock.nBytes   = 0;
+            pGarbage        = NULL;
+            nEngines        = 0;
+            nEnginesDone    = 0;
+        }
+
+        noise_generator::Launcher::~Launcher()
+        {
+            pCore           = NULL;
+        }
+
+        status_t noise_generator::Launcher::run()
+        {
+            // The plugin may be destroyed while the launcher waits for execution
+            if (!atomic_cas(&nState, uatomic_t(LS_READY), uatomic_t(LS_BUSY)))
+                return STATUS_CANCELLED;
+
+            // The analysis thread is started after the analyzer
+            nDone           = 0;
+            if (nRequest & LAUNCH_WORKERS)
+            {
+                pCore->start_workers();
+                nDone          |= LAUNCH_WORKERS;
+            }
+            if ((nRequest & LAUNCH_ANALYZER) && (pCore->init_analyzer()))
+                nDone          |= LAUNCH_ANALYZER;
+            if (nRequest & LAUNCH_ANALYSIS)
+            {
+                pAnalysis       = pCore->init_analysis_thread();
+                if (pAnalysis != NULL)
+                    nDone          |= LAUNCH_ANALYSIS;
+            }
+            if ((nRequest & LAUNCH_BUFFERS) && (pCore->alloc_block(&sBlock, sBlock.nSize)))
+                nDone          |= LAUNCH_BUFFERS;
+            if (nRequest & LAUNCH_FREE)
+            {
+                if (pGarbage != NULL)
+                {
+                    free_aligned(pGarbage);
+                    pGarbage        = NULL;
+                }
+                nDone          |= LAUNCH_FREE;
+            }
+            if (nRequest & LAUNCH_ENGINES)
+            {
+                nEnginesDone    = pCore->init_standby(nEngines);
+                nDone          |= LAUNCH_ENGINES;
+            }
+
+            return STATUS_OK;
+        }
+
+        //---------------------------------------------------------------------
+        noise_generator::Worker::Worker(noise_generator *core)
+        {
+            pCore           = core;
+        }
+
+        noise_generator::Worker::~Worker()
+        {
+            pCore           = NULL;
+        }
+
+        status_t noise_generator::Worker::run()
+        {
+            // Jobs run the same DSP code as the audio thread, so they need the same floating-point context
+            dsp::context_t ctx;
+            dsp::start(&ctx);
+            lsp_finally { dsp::finish(&ctx); };
+
+            size_t idle     = 0;
+
+            while (!is_cancelled())
+            {
+                if (pCore->claim_jobs() > 0)
+                {
+                    idle            = 0;
+                    continue;
+                }
+
+                // The jobs of the next stage follow shortly, so poll for a while before going to sleep
+                if (idle < WORKER_SPIN_COUNT)
+                {
+                    ++idle;
+                    cpu_relax();
+                    continue;
+                }
+
+                ipc::Thread::sleep((atomic_load(&pCore->nParallel)) ? WORKER_SLEEP_ACTIVE : WORKER_SLEEP_IDLE);
+            }
+
+            return STATUS_OK;
+        }
+
+        //---------------------------------------------------------------------
+        noise_generator::Analysis::Analysis(noise_generator *core)
+        {
+            pCore           = core;
+        }
+
+        noise_generator::Analysis::~Analysis()
+        {
+            pCore           = NULL;
+        }
+
+        status_t noise_generator::Analysis::run()
+        {
+            while (!is_cancelled())
+            {
+                if (!pCore->run_analysis())
+                    ipc::Thread::sleep(ANALYSIS_SLEEP);
+            }
+
+            return STATUS_OK;
+        }
+
+        //---------------------------------------------------------------------
         void noise_generator::init(plug::IWrapper *wrapper, plug::IPort **ports)
         {
             // Call parent class for initialisation
             Module::init(wrapper, ports);
-
-            // Initialize analyzer
-            size_t an_channels      = nChannels * 2 + meta::noise_generator::NUM_GENERATORS;
-            if (!sAnalyzer.init(an_channels, meta::noise_generator::FFT_RANK,
-                MAX_SAMPLE_RATE, meta::noise_generator::FFT_REFRESH_RATE))
+            pExecutor               = wrapper->executor();
+            pLauncher               = new Launcher(this);
+            if (pLauncher == NULL)
                 return;
 
-            sAnalyzer.set_rank(meta::noise_generator::FFT_RANK);
-            sAnalyzer.set_activity(false);
-            sAnalyzer.set_envelope(meta::noise_generator::FFT_ENVELOPE);
-            sAnalyzer.set_window(meta::noise_generator::FFT_WINDOW);
-            sAnalyzer.set_rate(meta::noise_generator::FFT_REFRESH_RATE);
+            // The analyzer, the analysis thread and their buffers are allocated when the analysis
+            // is enabled for the first time, buffers of the processing block are allocated separately
 
             // Estimate the number of bytes to allocate
             size_t szof_channels    = align_size(sizeof(channel_t) * nChannels, OPTIMAL_ALIGN);
 
             /** Buffers:
-             * 2X Temporary Buffer for Processing (BUFFER_SIZE)
              * 1X Frequency List (MESH_POINTS)
+             * 1X Frequency Indexes (MESH_POINTS)
              * 1X Complex Part of Frequency Response (MESH_POINTS)
              * 1X Frequency Chart of Channel (MESH_POINTS)
+             * 2X Crossfade curves for the noise table playback (CACHE_XFADE)
+             * 1X Envelope of the analyzer (FFT_ITEMS/2 + 1)
+             * 1X Cached frequency chart (MESH_POINTS)
+             * 3X Published frequency chart for each generator (MESH_POINTS)
+             * 1X Frequency chart for each generator (MESH_POINTS)
              */
-            size_t buf_sz           = align_size(BUFFER_SIZE * sizeof(float), OPTIMAL_ALIGN);
-            size_t idx_sz           = align_size(BUFFER_SIZE * sizeof(uint32_t), OPTIMAL_ALIGN);
             size_t chr_sz           = align_size(meta::noise_generator::MESH_POINTS *  sizeof(float), OPTIMAL_ALIGN);
-            size_t gen_sz           = (chr_sz + buf_sz) * meta::noise_generator::NUM_GENERATORS;
+            size_t xf_sz            = align_size(CACHE_XFADE * sizeof(float), OPTIMAL_ALIGN);
+            size_t env_sz           = align_size((meta::noise_generator::FFT_ITEMS/2 + 1) * sizeof(float), OPTIMAL_ALIGN);
             size_t alloc            = szof_channels + // vChannels
-                                      chr_sz + idx_sz + 2 * chr_sz +// vFreqs, vIndexes, vFreqChart[2]
-                                      gen_sz + // vGenerators[i].vFreqChart
-                                      nChannels * buf_sz * 2; // vChannels[i]: vInBuffer, vOutBuffer
+                                      chr_sz * 2 + 2 * chr_sz +// vFreqs, vIndexes, vFreqChart[2]
+                                      xf_sz * 2 + // vFadeIn, vFadeOut
+                                      env_sz + // vAnEnvelope
+                                      chr_sz * CHART_CACHE_SIZE + // vCharts
+                                      chr_sz * 3 * meta::noise_generator::NUM_GENERATORS + // vChartFrames
+                                      chr_sz * meta::noise_generator::NUM_GENERATORS; // vGenerators[i]: vFreqChart
 
             // Allocate memory-aligned data
             uint8_t *ptr            = alloc_aligned<uint8_t>(pData, alloc, OPTIMAL_ALIGN);
             lsp_guard_assert( uint8_t *guard = ptr );
             if (ptr == NULL)
                 return;
+            nDataSize               = alloc;
 
             // Initialise pointers to channels and temporary buffer
             vChannels               = reinterpret_cast<channel_t *>(ptr);
             ptr                    += szof_channels;
             vFreqs                  = reinterpret_cast<float *>(ptr);
-            ptr                    += idx_sz;
+            ptr                    += chr_sz;
             vIndexes                = reinterpret_cast<uint32_t *>(ptr);
             ptr                    += chr_sz;
             vFreqChart              = reinterpret_cast<float *>(ptr);
             ptr                    += chr_sz * 2;
+            vFadeIn                 = reinterpret_cast<float *>(ptr);
+            ptr                    += xf_sz;
+            vFadeOut                = reinterpret_cast<float *>(ptr);
+            ptr                    += xf_sz;
+            vAnEnvelope             = reinterpret_cast<float *>(ptr);
+            ptr                    += env_sz;
+            for (size_t i=0; i<CHART_CACHE_SIZE; ++i)
+            {
+                vCharts[i].vData        = reinterpret_cast<float *>(ptr);
+                ptr                    += chr_sz;
+            }
+            for (size_t i=0; i<3; ++i)
+            {
+                chart_frame_t *f        = &vChartFrames[i];
+                for (size_t j=0; j<meta::noise_generator::NUM_GENERATORS; ++j)
+                {
+                    f->vData[j]             = reinterpret_cast<float *>(ptr);
+                    ptr                    += chr_sz;
+                    dsp::fill_zero(f->vData[j], meta::noise_generator::MESH_POINTS);
+                }
+            }
 
-            // Initialize generators
-            for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
+            // The analyzer averages magnitudes of the windowed FFT: for white noise with unit deviation
+            // the magnitude of each bin is Rayleigh-distributed with the mean of sqrt(pi/4 * sum(w^2))
+            dspu::envelope::reverse_noise(vAnEnvelope, meta::noise_generator::FFT_ITEMS/2 + 1,
+                dspu::envelope::envelope_t(meta::noise_generator::FFT_ENVELOPE));
+            float *window           = static_cast<float *>(malloc(meta::noise_generator::FFT_ITEMS * sizeof(float)));
+            if (window != NULL)
             {
-                generator_t *g          = &vGenerators[i];
+                dspu::windows::window(window, meta::noise_generator::FFT_ITEMS,
+                    dspu::windows::window_t(meta::noise_generator::FFT_WINDOW));
+                fAnNorm                 = sqrtf(0.25f * M_PI * dsp::h_sqr_sum(window, meta::noise_generator::FFT_ITEMS)) /
+                                          meta::noise_generator::FFT_ITEMS;
+                free(window);
+            }
 
-                // Construct in-place DSP processors
-                g->sNoiseGenerator.construct();
-                g->sAudibleStop.construct();
-                g->sAudibleStop.init();
+            // The distributions of dspu::LCG have different power, the analytic spectrum needs the actual one
+            measure_lcg_sigma(vLCGSigma);
 
-                // We seed every noise generator differently so that they produce uncorrelated noise.
-                // We set the MLS number of bits to -1 so that the initialiser sets it to maximum.
-                g->sNoiseGenerator.init(
-                    -1, make_seed(),
-                    make_seed(),
-                    make_seed(), -1, make_seed());
+            // Segments of the noise table are uncorrelated, use equal-power crossfade
+            for (size_t i=0; i<CACHE_XFADE; ++i)
+            {
+                const float a           = (M_PI * 0.5f) * (i + 0.5f) / CACHE_XFADE;
+                vFadeIn[i]              = sinf(a);
+                vFadeOut[i]             = cosf(a);
+            }
 
-                // We also set the inaudible noise filter main properties. These are not user configurable.
-                g->sAudibleStop.set_order(INA_FILTER_ORD);
-                g->sAudibleStop.set_filter_type(dspu::BW_FLT_TYPE_HIGHPASS);
+            // Initialize generators
+            for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
+            {
+                generator_t *g          = &vGenerators[i];
 
-                // Same with colour
-                g->sNoiseGenerator.set_coloring_order(COLOR_FILTER_ORDER);
+                // Initialize the engine and its copy for the noise table renderer
+                g->nSeed                = make_seed();
+                g->nPosition            = 0;
+                if (!init_engine(g->pEngine, g->nSeed))
+                    return;
+                if (!init_engine(g->pStandby, g->nSeed))
+                    return;
+                g->bStandby             = true;
+                g->pCache               = new CacheRenderer();
+                if (g->pCache == NULL)
+                    return;
+                if (!init_engine(&g->pCache->sEngine, g->nSeed))
+                    return;
+                g->bValid               = true;
+                g->sRandom.init(derive_seed(g->nSeed, 6));
 
                 // Initialize settings
+                gen_params_t *gp        = &g->sParams;
+                gp->nType               = meta::noise_generator_metadata::NOISE_TYPE_OFF;
+                gp->enLCGDist           = dspu::LCG_UNIFORM;
+                gp->enVelvetType        = dspu::VN_VELVET_OVN;
+                gp->fVelvetWin          = 0.0f;
+                gp->fVelvetARNd         = 0.0f;
+                gp->bVelvetCrush        = false;
+                gp->fVelvetCrushProb    = 0.0f;
+                gp->enColor             = dspu::NG_COLOR_WHITE;
+                gp->enSlopeUnit         = dspu::STLT_SLOPE_UNIT_NEPER_PER_NEPER;
+                gp->fSlope              = 0.0f;
+                gp->fAmplitude          = 1.0f;
+                gp->fOffset             = 0.0f;
+                gp->bInaudible          = false;
+                gp->enInaFilter         = INA_FILTER_BUTTERWORTH;
+
                 g->fGain                = GAIN_AMP_0_DB;
                 g->bActive              = false;
-                g->bInaudible           = false;
                 g->bUpdPlots            = true;
+                g->bSyncChart           = false;
+                g->bAnalytic            = false;
+                g->fSigma               = 0.0f;
+                g->bFrozen              = false;
+                g->fLevel               = GAIN_AMP_M_INF_DB;
+                g->bSparse              = false;
+                g->nImpulses            = -1;
+                g->nConsumers           = 0;
+                g->nUpdate              = UPD_NOISE_ALL;
+
+                g->bCached              = false;
+                g->bCacheDirty          = false;
+                g->nCacheLength         = 0;
+                g->nCacheSize           = 0;
+                g->nCacheCap            = 0;
+                g->nCachePos            = 0;
+                g->nCacheLeft           = 0;
+                g->nFadePos             = 0;
+                g->nFadeDone            = CACHE_XFADE;
+                g->vCache               = NULL;
+                g->vFadeData            = NULL;
 
-                g->vBuffer              = reinterpret_cast<float *>(ptr);
-                ptr                    += buf_sz;
                 g->vFreqChart           = reinterpret_cast<float *>(ptr);
                 ptr                    += chr_sz;
 
@@ -316,6 +1042,10 @@ namespace lsp
                 g->pSlSw                = NULL;
                 g->pMtSw                = NULL;
                 g->pInaSw               = NULL;
+                g->pInaFilter           = NULL;
+                g->pCached              = NULL;
+                g->pCacheLen            = NULL;
+                g->pSeed                = NULL;
                 g->pLCGdist             = NULL;
                 g->pVelvetType          = NULL;
                 g->pVelvetWin           = NULL;
@@ -327,6 +1057,7 @@ namespace lsp
                 g->pCslopeDBO           = NULL;
                 g->pCslopeDBD           = NULL;
                 g->pMeterOut            = NULL;
+                g->pLoad                = NULL;
                 g->pFft                 = NULL;
                 g->pMsh                 = NULL;
                 g->pSpectrum            = NULL;
@@ -338,6 +1069,8 @@ namespace lsp
 
                 // Construct in-place DSP processors
                 c->sBypass.construct();
+                c->sMixLoad.construct();
+                c->sBypassLoad.construct();
 
                 // Initialise fields
                 c->enMode 				= CH_MODE_OVERWRITE;
@@ -345,13 +1078,17 @@ namespace lsp
                     c->vGain[j]             = GAIN_AMP_0_DB;
                 c->fGainIn              = GAIN_AMP_0_DB;
                 c->fGainOut             = GAIN_AMP_0_DB;
+                for (size_t j=0; j < meta::noise_generator::NUM_GENERATORS; ++j)
+                    c->vMix[j]              = GAIN_AMP_0_DB;
+                c->fMixIn               = GAIN_AMP_0_DB;
+                c->nSources             = 0;
+                c->fLevelIn             = GAIN_AMP_M_INF_DB;
+                c->fLevelOut            = GAIN_AMP_M_INF_DB;
                 c->bActive              = true;
-                c->vInBuffer            = reinterpret_cast<float *>(ptr);
-                ptr                    += buf_sz;
-                c->vOutBuffer           = reinterpret_cast<float *>(ptr);
-                ptr                    += buf_sz;
+                c->nUpdate              = UPD_NOISE_MODE;
                 c->vIn                  = NULL;
                 c->vOut                 = NULL;
+                c->vOutData             = NULL;
 
                 // Initialize ports
                 c->pIn                  = NULL;
@@ -367,6 +1104,7 @@ namespace lsp
                 c->pGainOut             = NULL;
                 c->pMeterIn             = NULL;
                 c->pMeterOut            = NULL;
+                c->pLoad                = NULL;
                 c->pSpectrumIn          = NULL;
                 c->pSpectrumOut         = NULL;
             }
@@ -395,6 +1133,13 @@ namespace lsp
             pFftGen                     = TRACE_PORT(ports[port_id++]);
             pReactivity                 = TRACE_PORT(ports[port_id++]);
             pShiftGain                  = TRACE_PORT(ports[port_id++]);
+            pFftThread                  = TRACE_PORT(ports[port_id++]);
+            pFftAnalytic                = TRACE_PORT(ports[port_id++]);
+            pParallel                   = TRACE_PORT(ports[port_id++]);
+            pSeeded                     = TRACE_PORT(ports[port_id++]);
+            pSeed                       = TRACE_PORT(ports[port_id++]);
+            pMeasure                    = TRACE_PORT(ports[port_id++]);
+            pLoad                       = TRACE_PORT(ports[port_id++]);
 
             // Bind generator ports
             lsp_trace("Binding generator ports");
@@ -408,6 +1153,10 @@ namespace lsp
                 g->pSlSw                = TRACE_PORT(ports[port_id++]);
                 g->pMtSw                = TRACE_PORT(ports[port_id++]);
                 g->pInaSw               = TRACE_PORT(ports[port_id++]);
+                g->pInaFilter           = TRACE_PORT(ports[port_id++]);
+                g->pCached              = TRACE_PORT(ports[port_id++]);
+                g->pCacheLen            = TRACE_PORT(ports[port_id++]);
+                g->pSeed                = TRACE_PORT(ports[port_id++]);
 
                 g->pLCGdist             = TRACE_PORT(ports[port_id++]);
 
@@ -424,6 +1173,7 @@ namespace lsp
 
                 g->pFft                 = TRACE_PORT(ports[port_id++]);
                 g->pMeterOut            = TRACE_PORT(ports[port_id++]);
+                g->pLoad                = TRACE_PORT(ports[port_id++]);
                 g->pMsh                 = TRACE_PORT(ports[port_id++]);
                 g->pSpectrum            = TRACE_PORT(ports[port_id++]);
             }
@@ -448,52 +1198,388 @@ namespace lsp
                 c->pGainOut             = TRACE_PORT(ports[port_id++]);
                 c->pMeterIn             = TRACE_PORT(ports[port_id++]);
                 c->pMeterOut            = TRACE_PORT(ports[port_id++]);
+                c->pLoad                = TRACE_PORT(ports[port_id++]);
                 c->pSpectrumIn          = TRACE_PORT(ports[port_id++]);
                 c->pSpectrumOut         = TRACE_PORT(ports[port_id++]);
             }
 
             lsp_assert(ptr <= &guard[alloc]);
+
+            // Allocate buffers of the processing block
+            if (!resize_buffers(BUFFER_SIZE_DFL))
+                return;
+
+            lsp_trace("Memory footprint: %d bytes", int(memory_footprint()));
         }
 
-        void noise_generator::destroy()
+        bool noise_generator::alloc_block(block_t *b, size_t size) const
         {
-            Module::destroy();
-            do_destroy();
+            /** Buffers:
+             * 1X Temporary Buffer for each generator (size)
+             * 2X Impulse list for each generator (size / SPARSE_DENSITY)
+             * 2X Temporary Buffer for each channel (size)
+             */
+            size_t buf_sz           = align_size(size * sizeof(float), OPTIMAL_ALIGN);
+            size_t imp_sz           = align_size((size / SPARSE_DENSITY) * sizeof(float), OPTIMAL_ALIGN);
+            size_t alloc            = (buf_sz + imp_sz * 2) * meta::noise_generator::NUM_GENERATORS + // vGenerators[i]: vBuffer, vImpIdx, vImpAmp
+                                      buf_sz * 2 * nChannels; // vChannels[i]: vInBuffer, vOutBuffer
+
+            uint8_t *data           = NULL;
+            uint8_t *ptr            = alloc_aligned<uint8_t>(data, alloc, OPTIMAL_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            // The content of frozen generators should stay silent
+            dsp::fill_zero(reinterpret_cast<float *>(ptr), alloc / sizeof(float));
+
+            b->pData                = data;
+            b->pPtr                 = ptr;
+            b->nSize                = size;
+            b->nBytes               = alloc;
+
+            return true;
         }
 
-        void noise_generator::do_destroy()
+        void noise_generator::bind_block(const block_t *b)
         {
-            // Drop inline display data structures
-            if (pIDisplay != NULL)
-            {
-                pIDisplay->destroy();
-                pIDisplay   = NULL;
-            }
+            const size_t size       = b->nSize;
+            size_t buf_sz           = align_size(size * sizeof(float), OPTIMAL_ALIGN);
+            size_t imp_sz           = align_size((size / SPARSE_DENSITY) * sizeof(float), OPTIMAL_ALIGN);
+            uint8_t *ptr            = b->pPtr;
+            lsp_guard_assert( uint8_t *guard = ptr );
 
-            // Destroy channels
-            if (vChannels != NULL)
+            for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
             {
-                for (size_t i=0; i<nChannels; ++i)
-                {
-                    channel_t *c    = &vChannels[i];
-                    c->sBypass.destroy();
-                }
-                vChannels = NULL;
+                generator_t *g          = &vGenerators[i];
+                g->vBuffer              = reinterpret_cast<float *>(ptr);
+                ptr                    += buf_sz;
+                g->vImpIdx              = reinterpret_cast<uint32_t *>(ptr);
+                ptr                    += imp_sz;
+                g->vImpAmp              = reinterpret_cast<float *>(ptr);
+                ptr                    += imp_sz;
             }
-
-            // Destroy noise generators
-            for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                c->vInBuffer            = reinterpret_cast<float *>(ptr);
+                ptr                    += buf_sz;
+                c->vOutBuffer           = reinterpret_cast<float *>(ptr);
+                ptr                    += buf_sz;
+            }
+            lsp_assert(ptr <= &guard[b->nBytes]);
+
+            pBlockData              = b->pData;
+            nBlockDataSize          = b->nBytes;
+            nBlockSize              = size;
+        }
+
+        bool noise_generator::resize_buffers(size_t size)
+        {
+            block_t b;
+            if (!alloc_block(&b, size))
+                return false;
+
+            // Replace previously allocated buffers
+            uint8_t *old            = pBlockData;
+            bind_block(&b);
+            if (old != NULL)
+                free_aligned(old);
+
+            return true;
+        }
+
+        bool noise_generator::init_analyzer()
+        {
+            if (!sAnalyzer.init(analysis_channels(), meta::noise_generator::FFT_RANK,
+                MAX_SAMPLE_RATE, meta::noise_generator::FFT_REFRESH_RATE))
+            {
+                sAnalyzer.destroy();
+                return false;
+            }
+
+            sAnalyzer.set_rank(meta::noise_generator::FFT_RANK);
+            sAnalyzer.set_activity(false);
+            sAnalyzer.set_envelope(meta::noise_generator::FFT_ENVELOPE);
+            sAnalyzer.set_window(meta::noise_generator::FFT_WINDOW);
+            sAnalyzer.set_rate(meta::noise_generator::FFT_REFRESH_RATE);
+
+            return true;
+        }
+
+        noise_generator::Analysis *noise_generator::init_analysis_thread()
+        {
+            const size_t an_channels    = analysis_channels();
+            if (pAnData == NULL)
+            {
+                if (!sAnRing.init(an_channels, ANALYSIS_RING_SIZE))
+                    return NULL;
+
+                /** Buffers:
+                 * 1X Buffer of the analysis thread for each analyzer channel (ANALYSIS_BLOCK_SIZE)
+                 * 3X Published spectrum for each analyzer channel (MESH_POINTS)
+                 */
+                size_t buf_sz           = align_size(ANALYSIS_BLOCK_SIZE * sizeof(float), OPTIMAL_ALIGN);
+                size_t chr_sz           = align_size(meta::noise_generator::MESH_POINTS *  sizeof(float), OPTIMAL_ALIGN);
+                size_t alloc            = an_channels * (buf_sz + chr_sz * 3); // vAnBuffers, vAnSpectra
+
+                uint8_t *ptr            = alloc_aligned<uint8_t>(pAnData, alloc, OPTIMAL_ALIGN);
+                if (ptr == NULL)
+                {
+                    sAnRing.destroy();
+                    return NULL;
+                }
+                nAnDataSize             = alloc;
+
+                for (size_t i=0; i<an_channels; ++i)
+                {
+                    vAnBuffers[i]           = reinterpret_cast<float *>(ptr);
+                    ptr                    += buf_sz;
+                }
+                vAnSpectra              = reinterpret_cast<float *>(ptr);
+                dsp::fill_zero(vAnSpectra, meta::noise_generator::MESH_POINTS * 3 * an_channels);
+            }
+
+            // Launch the analysis thread, the analysis runs on the audio thread if it is not available
+            Analysis *an            = new Analysis(this);
+            if (an == NULL)
+                return NULL;
+            if (an->start() != STATUS_OK)
+            {
+                delete an;
+                return NULL;
+            }
+
+            return an;
+        }
+
+        void noise_generator::update_frequencies(float sr)
+        {
+            // Map frequencies to FFT bins the same way as the analyzer does, the list is
+            // needed for the charts even if the analyzer has not been allocated yet
+            const size_t last           = meta::noise_generator::FFT_ITEMS / 2;
+            const float f_max           = lsp_min(sr * 0.5f, SPEC_FREQ_MAX);
+            const float norm            = logf(f_max / SPEC_FREQ_MIN) / (meta::noise_generator::MESH_POINTS - 1);
+            const float scale           = meta::noise_generator::FFT_ITEMS / sr;
+
+            for (size_t i=0; i<meta::noise_generator::MESH_POINTS; ++i)
+            {
+                const float f               = SPEC_FREQ_MIN * expf(i * norm);
+                const size_t idx            = scale * f;
+                vFreqs[i]                   = f;
+                vIndexes[i]                 = lsp_min(idx, last);
+            }
+        }
+
+        void noise_generator::set_tile_size(size_t size)
+        {
+            nTileSize       = size;
+        }
+
+        size_t noise_generator::memory_footprint() const
+        {
+            size_t bytes    = sizeof(noise_generator) + nDataSize + nBlockDataSize + nAnDataSize + sAnRing.footprint();
+            if (pLauncher != NULL)
+                bytes          += sizeof(Launcher);
+
+            // The analyzer keeps the sample history and the spectrum of each channel and a few
+            // shared FFT buffers, estimate its size from the initialization parameters
+            if (bAnInit)
+            {
+                const size_t fft_size   = meta::noise_generator::FFT_ITEMS;
+                const size_t history    = MAX_SAMPLE_RATE / meta::noise_generator::FFT_REFRESH_RATE + fft_size;
+                bytes                  += (analysis_channels() * (history + fft_size) + fft_size * 5) * sizeof(float);
+            }
+
+            // Noise tables
+            for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
+            {
+                const generator_t *g    = &vGenerators[i];
+                bytes                  += g->nCacheCap * sizeof(float);
+                if (g->pCache != NULL)
+                    bytes                  += sizeof(CacheRenderer) + g->pCache->nCapacity * sizeof(float);
+            }
+
+            return bytes;
+        }
+
+        void noise_generator::destroy()
+        {
+            Module::destroy();
+            do_destroy();
+        }
+
+        void noise_generator::do_destroy()
+        {
+            // Wait until the noise table renderers and the launcher finish their jobs: the task
+            // which is submitted but not started yet still will be executed later. The renderer
+            // does not refer to the plugin, so it is just left to the executor if it does not complete
+            for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
+            {
+                generator_t *g      = &vGenerators[i];
+                if ((g->pCache != NULL) && (!wait_task(g->pCache, TASK_WAIT_TIMEOUT)))
+                {
+                    lsp_warn("Noise table renderer of generator %d did not complete, leaving it to the executor", int(i));
+                    g->pCache           = NULL;
+                }
+            }
+            // The launcher which has not started yet is cancelled. The started launcher does
+            // not wait for anything and completes shortly, so it is waited for until completion
+            Launcher *l         = pLauncher;
+            if (l != NULL)
+            {
+                if ((l->submitted()) || (l->running()))
+                {
+                    if (!atomic_cas(&l->nState, uatomic_t(LS_READY), uatomic_t(LS_CANCELLED)))
+                    {
+                        while (!wait_task(l, TASK_WAIT_TIMEOUT))
+                            lsp_warn("Launcher has not completed in %d ms, waiting more", int(TASK_WAIT_TIMEOUT));
+                    }
+                    else if (!wait_task(l, TASK_WAIT_TIMEOUT))
+                    {
+                        // The executor still refers to the cancelled launcher, leave it there
+                        lsp_warn("Cancelled launcher has not been released by the executor, leaving it to the executor");
+                        if (l->pGarbage != NULL)
+                        {
+                            free_aligned(l->pGarbage);
+                            l->pGarbage         = NULL;
+                        }
+                        l                   = NULL;
+                    }
+                }
+                pLauncher           = NULL;
+            }
+
+            if (l != NULL)
+            {
+                // Stop the analysis thread which has not been taken from the launcher
+                if (l->pAnalysis != NULL)
+                {
+                    l->pAnalysis->cancel();
+                    l->pAnalysis->join();
+                    delete l->pAnalysis;
+                    l->pAnalysis        = NULL;
+                }
+
+                // Free the buffers of the processing block which have not been taken from the launcher
+                if (l->sBlock.pData != NULL)
+                {
+                    free_aligned(l->sBlock.pData);
+                    l->sBlock.pData     = NULL;
+                }
+                if (l->pGarbage != NULL)
+                {
+                    free_aligned(l->pGarbage);
+                    l->pGarbage         = NULL;
+                }
+                delete l;
+            }
+            if (pBlockGarbage != NULL)
+            {
+                free_aligned(pBlockGarbage);
+                pBlockGarbage           = NULL;
+            }
+
+            // Stop worker threads
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                Worker *w       = vWorkers[i];
+                w->cancel();
+                w->join();
+                delete w;
+                vWorkers[i]     = NULL;
+            }
+            nWorkers        = 0;
+            bWorkers        = false;
+
+            // Stop the analysis thread
+            if (pAnalysis != NULL)
+            {
+                pAnalysis->cancel();
+                pAnalysis->join();
+                delete pAnalysis;
+                pAnalysis       = NULL;
+            }
+            atomic_store(&nAnState, uatomic_t(AN_DIRECT));
+            bAnThread       = false;
+
+            // Drop inline display data structures
+            if (pIDisplay != NULL)
+            {
+                pIDisplay->destroy();
+                pIDisplay   = NULL;
+            }
+            if (vIDisplayIdx != NULL)
+            {
+                free(vIDisplayIdx);
+                vIDisplayIdx    = NULL;
+            }
+            nIDisplayWidth  = 0;
+            nIDisplayHeight = 0;
+            bIDisplayValid  = false;
+
+            // Destroy channels
+            if (vChannels != NULL)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c    = &vChannels[i];
+                    c->sBypass.destroy();
+                    c->sMixLoad.destroy();
+                    c->sBypassLoad.destroy();
+                }
+                vChannels = NULL;
+            }
+
+            // Destroy noise generators
+            for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
             {
                 generator_t *g  = &vGenerators[i];
                 g->vFreqChart   = NULL;
-                g->sNoiseGenerator.destroy();
-                g->sAudibleStop.destroy();
+
+                destroy_engine(&g->vEngines[0]);
+                destroy_engine(&g->vEngines[1]);
+                g->bStandby     = false;
+
+                // Drop noise tables
+                if (g->vCache != NULL)
+                {
+                    free(g->vCache);
+                    g->vCache       = NULL;
+                }
+                g->vFadeData    = NULL;
+                g->nCacheSize   = 0;
+                g->nCacheCap    = 0;
+
+                // Destroy the noise table renderer
+                CacheRenderer *r    = g->pCache;
+                if (r != NULL)
+                {
+                    destroy_engine(&r->sEngine);
+                    delete r;
+                    g->pCache       = NULL;
+                }
             }
 
             // Forget about buffers
             vFreqs      = NULL;
             vIndexes    = NULL;
             vFreqChart  = NULL;
+            vFadeIn     = NULL;
+            vFadeOut    = NULL;
+            for (size_t i=0; i<MAX_AN_CHANNELS; ++i)
+                vAnBuffers[i]   = NULL;
+            vAnSpectra  = NULL;
+            vAnEnvelope = NULL;
+            for (size_t i=0; i<CHART_CACHE_SIZE; ++i)
+            {
+                vCharts[i].bValid   = false;
+                vCharts[i].vData    = NULL;
+            }
+            for (size_t i=0; i<3; ++i)
+            {
+                for (size_t j=0; j<meta::noise_generator::NUM_GENERATORS; ++j)
+                    vChartFrames[i].vData[j]    = NULL;
+            }
 
             // Free previously allocated data chunk
             if (pData != NULL)
@@ -501,20 +1587,48 @@ namespace lsp
                 free_aligned(pData);
                 pData       = NULL;
             }
+            if (pBlockData != NULL)
+            {
+                free_aligned(pBlockData);
+                pBlockData  = NULL;
+            }
+            if (pAnData != NULL)
+            {
+                free_aligned(pAnData);
+                pAnData     = NULL;
+            }
+            nDataSize       = 0;
+            nBlockDataSize  = 0;
+            nAnDataSize     = 0;
+            nBlockSize      = 0;
+            bAnInit         = false;
 
             // Destroy analyzer
             sAnalyzer.destroy();
+            sAnRing.destroy();
         }
 
         void noise_generator::update_sample_rate(long sr)
         {
-            // Update analyzer and initialize list of frequencies
-            sAnalyzer.set_sample_rate(sr);
-            sAnalyzer.get_frequencies(
-                vFreqs, vIndexes,
-                SPEC_FREQ_MIN, lsp_min(sr * 0.5f, SPEC_FREQ_MAX),
-                meta::noise_generator_metadata::MESH_POINTS
-            );
+            // Workers are own threads of the plugin, so they complete the late jobs shortly
+            while ((bStalled) && (!jobs_settled()))
+                ipc::Thread::sleep(1);
+
+            // Take the resources allocated by the launcher if it has completed, it is not waited for:
+            // the launcher does not use the sample rate and the analyzer is not touched until it is taken
+            finish_launch();
+
+            // Update analyzer and initialize list of frequencies, the analysis thread should not use them
+            release_analysis();
+            nAnPeriod       = lsp_max(size_t(sr / meta::noise_generator::FFT_REFRESH_RATE), size_t(1));
+            if (bAnInit)
+                sAnalyzer.set_sample_rate(sr);
+            update_frequencies(sr);
+
+            // Grow buffers up to the maximum block length seen so far right here, the launcher
+            // is not waited for by the host and may complete later
+            if (nMaxBlock > nBlockSize)
+                resize_buffers(nMaxBlock);
 
             // Update sample rate for channel processors
             for (size_t i=0; i<nChannels; ++i)
@@ -522,22 +1636,37 @@ namespace lsp
                 channel_t *c    = &vChannels[i];
                 c->sBypass.init(sr);
             }
+            nBypassHold     = dspu::seconds_to_samples(sr, BYPASS_SETTLE_TIME);
+            nCacheSegment   = dspu::seconds_to_samples(sr, CACHE_SEGMENT_TIME);
 
             // Update sample rate for generators
             for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
             {
                 generator_t *g  = &vGenerators[i];
-                g->sNoiseGenerator.set_sample_rate(sr);
-                g->sAudibleStop.set_sample_rate(sr);
-                g->sAudibleStop.set_cutoff_frequency(INA_FILTER_CUTOFF);
+                update_engine_sample_rate(g->pEngine, sr);
+                g->bCacheDirty  = true;
+                g->bUpdPlots    = true;
+
+                // The stream depends on the sample rate, so start it again
+                if ((bSeeded) && (!restart_generator(g, g->nSeed, 0)))
+                    lsp_warn("Failed to restart generator %d", int(i));
             }
         }
 
         void noise_generator::update_settings()
         {
+            // Workers still execute the jobs which missed the deadline, apply settings after them
+            if ((bStalled) && (!jobs_settled()))
+            {
+                bSettingsPending    = true;
+                return;
+            }
+            bSettingsPending    = false;
+
             // Use if the sample rate does not allow actual inaudible noise
             bool force_audible  = (0.5f * fSampleRate) < INA_FILTER_CUTOFF;
             bool bypass         = pBypass->value() >= 0.5f;
+            bool redraw         = bypass != bBypass;
 
             // Check if one of the channels is solo.
             bool g_has_solo     = false;
@@ -548,15 +1677,45 @@ namespace lsp
             bool fft_out        = pFftOut->value() >= 0.5f;
             bool fft_gen        = pFftGen->value() >= 0.5f;
             bool fft_on         = fft_in || fft_out || fft_gen;
-            if (fft_on != sAnalyzer.activity())
+            const an_config_t an_prev   = sAnConfig;
+
+            // Deterministic seeding mode
+            const bool seeded       = pSeeded->value() >= 0.5f;
+            const uint32_t g_seed   = pSeed->value();
+
+            // Start collecting the DSP load statistics from scratch each time the measurement is enabled
+            const bool measure      = pMeasure->value() >= 0.5f;
+            if ((measure) && (!bMeasure))
             {
-                sAnalyzer.reset();
-                sAnalyzer.set_activity(fft_on);
+                for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
+                {
+                    vGenerators[i].sGenLoad.reset();
+                    vGenerators[i].sInaLoad.reset();
+                    vGenerators[i].sCacheLoad.reset();
+                }
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    vChannels[i].sMixLoad.reset();
+                    vChannels[i].sBypassLoad.reset();
+                }
+                sAnLoad.reset();
+                sTotalLoad.reset();
             }
-
-            // Update reactivity and shift gain
-            sAnalyzer.set_reactivity(pReactivity->value());
-            sAnalyzer.set_shift(pShiftGain->value() * 100.0f);
+            bMeasure                = measure;
+            // The analyzer is allocated by the launcher on the first use and stays
+            // inactive until then. It is configured by its owner thread
+            const bool fft_thread   = pFftThread->value() >= 0.5f;
+            if ((fft_on) && (!(nLaunched & LAUNCH_ANALYZER)))
+                nLaunch                |= LAUNCH_ANALYZER;
+            if ((fft_on) && (fft_thread) && (!(nLaunched & LAUNCH_ANALYSIS)))
+                nLaunch                |= LAUNCH_ANALYSIS;
+            bFftOn                  = fft_on;
+            bFftThread              = fft_thread;
+            sAnConfig.bActive       = (fft_on) && (bAnInit);
+            sAnConfig.fReactivity   = pReactivity->value();
+            sAnConfig.fShift        = pShiftGain->value() * 100.0f;
+            bAnThread               = (pAnalysis != NULL) && (bAnInit) && (fft_thread);
+            const bool analytic     = pFftAnalytic->value() >= 0.5f;
 
             // Search for soloing channels
             for (size_t i=0; i<nChannels; ++i)
@@ -590,104 +1749,1090 @@ namespace lsp
                 // is active. Otherwise, we check whether the channel was set to mute or not.
                 bool solo               = (g->pSlSw != NULL) ? g->pSlSw->value() >= 0.5f : false;
                 bool mute               = (g->pMtSw != NULL) ? g->pMtSw->value() >= 0.5f : false;
+                const bool was_active   = g->bActive;
                 g->bActive              = (g_has_solo) ? solo : !mute;
-                g->bInaudible           = (force_audible) ? false : g->pInaSw->value() >= 0.5f;
-
-                // Configure noise generator
-                dspu::lcg_dist_t lcgdist = get_lcg_dist(g->pLCGdist->value());
-                dspu::vn_velvet_type_t velvettype = get_velvet_type(g->pVelvetType->value());
-                bool velvetcs           = g->pVelvetCSW->value() >= 0.5f;
-                float velvetcsp         = g->pVelvetCpr->value() * 0.01f;
-                dspu::ng_color_t color  = (g->bInaudible) ? dspu::NG_COLOR_WHITE : get_color(g->pColorSel->value());
-                dspu::stlt_slope_unit_t color_slope_unit    = get_color_slope_unit(g->pColorSel->value());
-
-                float color_slope       = -0.5f;
-                switch (color_slope_unit)
+
+                // Collect the generator parameters
+                gen_params_t gp;
+                gp.nType                = g->pNoiseType->value();
+                gp.enLCGDist            = get_lcg_dist(g->pLCGdist->value());
+                gp.enVelvetType         = get_velvet_type(g->pVelvetType->value());
+                gp.fVelvetWin           = g->pVelvetWin->value();
+                gp.fVelvetARNd          = g->pVelvetARNd->value();
+                gp.bVelvetCrush         = g->pVelvetCSW->value() >= 0.5f;
+                gp.fVelvetCrushProb     = g->pVelvetCpr->value() * 0.01f;
+                gp.bInaudible           = (force_audible) ? false : g->pInaSw->value() >= 0.5f;
+                gp.enInaFilter          = get_ina_filter(g->pInaFilter->value());
+                gp.fAmplitude           = g->pAmplitude->value();
+                gp.fOffset              = g->pOffset->value();
+
+                // If the noise has to be inaudible we are best setting it to white, or excessive high frequency boost will make it audible.
+                // Conversely, excessive low frequency attenuation will make it non-existent.
+                gp.enColor              = (gp.bInaudible) ? dspu::NG_COLOR_WHITE : get_color(g->pColorSel->value());
+                gp.enSlopeUnit          = get_color_slope_unit(g->pColorSel->value());
+                switch (gp.enSlopeUnit)
                 {
                     case dspu::STLT_SLOPE_UNIT_DB_PER_OCTAVE:
-                        color_slope         = g->pCslopeDBO->value();
+                        gp.fSlope           = g->pCslopeDBO->value();
                         break;
 
                     case dspu::STLT_SLOPE_UNIT_DB_PER_DECADE:
-                        color_slope         = g->pCslopeDBD->value();
+                        gp.fSlope           = g->pCslopeDBD->value();
                         break;
 
                     case dspu::STLT_SLOPE_UNIT_NEPER_PER_NEPER:
                     default:
-                        color_slope         = g->pCslopeNPN->value();
+                        gp.fSlope           = g->pCslopeNPN->value();
                         break;
                 }
 
-                // If the noise has to be inaudible we are best setting it to white, or excessive high frequency boost will make it audible.
-                // Conversely, excessive low frequency attenuation will make it non-existent.
-                g->sNoiseGenerator.set_lcg_distribution(lcgdist);
-                g->sNoiseGenerator.set_velvet_type(velvettype);
-                g->sNoiseGenerator.set_velvet_window_width(g->pVelvetWin->value());
-                g->sNoiseGenerator.set_velvet_arn_delta(g->pVelvetARNd->value());
-                g->sNoiseGenerator.set_velvet_crush(velvetcs);
-                g->sNoiseGenerator.set_velvet_crushing_probability(velvetcsp);
-                g->sNoiseGenerator.set_noise_color(color);
-                g->sNoiseGenerator.set_color_slope(color_slope, color_slope_unit);
-                g->sNoiseGenerator.set_amplitude(g->pAmplitude->value());
-                g->sNoiseGenerator.set_offset(g->pOffset->value());
-
-                size_t noise_type = g->pNoiseType->value();
-                switch (noise_type)
+                if (gp.nType == meta::noise_generator_metadata::NOISE_TYPE_OFF)
+                    g->bActive          = false;
+
+                // Configure noise generator, only the changed settings are applied
+                const size_t upd        = g->nUpdate | params_changes(&gp, &g->sParams);
+                if (upd != 0)
+                    configure_engine(g->pEngine, &gp, upd);
+                g->nUpdate              = 0;
+
+                // In the deterministic mode the seed is derived from the global seed, the seed
+                // of the generator and its index, otherwise the seed chosen at startup is kept.
+                // The stream starts again if the seed or the type of the noise changes, other
+                // settings are applied to the running stream.
+                const uint32_t seed     = (seeded) ? derive_seed(g_seed, derive_seed(uint32_t(g->pSeed->value()), i)) : g->nSeed;
+                const bool changed      = (seed != g->nSeed) || (upd != 0);
+                const bool restart      = (seeded) && ((!bSeeded) || (seed != g->nSeed) || (upd & UPD_NOISE_TYPE));
+
+                // The noise table needs to be rendered again if the output of generator changes
+                const bool cached       = g->pCached->value() >= 0.5f;
+                const size_t cache_len  = lsp_max(
+                    dspu::seconds_to_samples(fSampleRate, g->pCacheLen->value()),
+                    nCacheSegment + CACHE_XFADE);
+                if ((cached) && ((!g->bCached) || (cache_len != g->nCacheLength) || (changed) || (restart)))
+                    g->bCacheDirty      = true;
+                g->bCached          = cached;
+                g->nCacheLength     = cache_len;
+                g->sParams          = gp;
+                if (restart)
+                    reseed_generator(g, seed);
+
+                // White velvet noise without offset consists of sparse impulses, any filtering makes it dense
+                g->bSparse          =
+                    (gp.nType == meta::noise_generator_metadata::NOISE_TYPE_VELVET) &&
+                    (gp.enColor == dspu::NG_COLOR_WHITE) &&
+                    (!gp.bInaudible) &&
+                    (gp.fOffset == 0.0f) &&
+                    (!g->bCached);
+
+                // The spectrum of white noise sources is known from the frequency chart. Velvet noise
+                // depends on the impulse density and the inaudible filter is not shown on the chart.
+                switch (gp.nType)
                 {
                     case meta::noise_generator_metadata::NOISE_TYPE_MLS:
-                        g->sNoiseGenerator.set_generator(dspu::NG_GEN_MLS);
-                        break;
-                    case meta::noise_generator_metadata::NOISE_TYPE_VELVET:
-                        g->sNoiseGenerator.set_generator(dspu::NG_GEN_VELVET);
+                        g->fSigma           = gp.fAmplitude;
                         break;
                     case meta::noise_generator_metadata::NOISE_TYPE_LCG:
-                        g->sNoiseGenerator.set_generator(dspu::NG_GEN_LCG);
+                        g->fSigma           = gp.fAmplitude * vLCGSigma[gp.enLCGDist];
+                        break;
+                    case meta::noise_generator_metadata::NOISE_TYPE_SPECTRAL:
+                    case meta::noise_generator_metadata::NOISE_TYPE_COUNTER:
+                        // All distributions of the counter-based generator have the power of uniform noise
+                        g->fSigma           = gp.fAmplitude / sqrtf(3.0f);
                         break;
-                    case meta::noise_generator_metadata::NOISE_TYPE_OFF:
                     default:
-                        g->sNoiseGenerator.set_generator(dspu::NG_GEN_LCG);
-                        g->bActive          = false;
+                        g->fSigma           = 0.0f;
                         break;
                 }
+                // The analytic spectrum replaces the measured one, so it is shown only if the spectrum is enabled
+                bool g_fft_on       = (g->pFft != NULL) ? g->pFft->value() >= 0.5f : true;
+                g->bAnalytic        =
+                    (fft_gen) &&
+                    (g_fft_on) &&
+                    (analytic) &&
+                    (!gp.bInaudible) &&
+                    (gp.nType != meta::noise_generator_metadata::NOISE_TYPE_VELVET);
+
+                // Set analyzer activity
+                sAnConfig.vEnabled[an_id++] = (fft_gen) && (g_fft_on) && (!g->bAnalytic);
+                g->nConsumers       = ((fft_gen) && (g_fft_on) && (!g->bAnalytic)) ? GC_FFT : 0;
+
+                // Plots need update only if the frequency response or the activity has changed
+                if ((upd & (UPD_NOISE_TYPE | UPD_NOISE_COLOR | UPD_NOISE_INAUDIBLE)) || (g->bActive != was_active))
+                {
+                    g->bUpdPlots        = true;
+                    redraw              = true;
+                }
+            }
+
+
+            bSeeded                 = seeded;
+
+            // Track the bypass crossfade
+            if (bypass != bBypass)
+            {
+                bBypass                 = bypass;
+                nBypassHold             = dspu::seconds_to_samples(fSampleRate, BYPASS_SETTLE_TIME);
+            }
+
+            // Update the configuration of each output channel
+            const float gain_out    = pGainOut->value();
+            const bool out_changed  = gain_out != fGainOut;
+            fGainIn                 = pGainIn->value();
+            fGainOut                = gain_out;
+            bParallel               = pParallel->value() >= 0.5f;
+            atomic_store(&nParallel, uatomic_t(bParallel));
+            if ((bParallel) && (!(nLaunched & LAUNCH_WORKERS)))
+                nLaunch                |= LAUNCH_WORKERS;
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                bool solo               = (c->pSlSw != NULL) ? c->pSlSw->value() >= 0.5f : false;
+                bool mute               = (c->pMtSw != NULL) ? c->pMtSw->value() >= 0.5f : false;
+
+                const ch_mode_t mode    = get_channel_mode(c->pNoiseMode->value());
+                const float ch_gain_out = c->pGainOut->value();
+                const bool active       = (c_has_solo) ? solo : !mute;
+                if ((mode != c->enMode) || (ch_gain_out != c->fGainOut) || (active != c->bActive) || (out_changed))
+                    c->nUpdate             |= UPD_NOISE_MODE;
+                for (size_t j=0; j<meta::noise_generator_metadata::NUM_GENERATORS; ++j)
+                {
+                    const float gain        = c->pGain[j]->value();
+                    if (gain != c->vGain[j])
+                        c->nUpdate             |= UPD_NOISE_MODE;
+                    c->vGain[j]             = gain;
+                }
+                c->enMode               = mode;
+                c->fGainIn              = c->pGainIn->value();
+                c->fGainOut             = ch_gain_out;
+                c->bActive              = active;
+
+                // Compute the mixing coefficients: fold the channel and overall output gains into
+                // the generator gains so that the whole channel is mixed within a single pass.
+                // Multiply mode applies the channel output gain twice: once to the generators
+                // and once to the input signal
+                if (c->nUpdate & UPD_NOISE_MODE)
+                {
+                    float mix_gain          = c->fGainOut * fGainOut;
+                    if (c->enMode == CH_MODE_MULT)
+                        mix_gain               *= c->fGainOut;
+                    for (size_t j=0; j<meta::noise_generator_metadata::NUM_GENERATORS; ++j)
+                        c->vMix[j]              = (c->bActive) ? c->vGain[j] * mix_gain : 0.0f;
+                    c->fMixIn               = c->fGainOut * fGainOut;
+                    c->nUpdate              = 0;
+                }
+
+                // Compile the list of generators mixed into the channel. Inactive generators
+                // produce silence, so they are skipped as well as the zero gains
+                c->nSources             = 0;
+                for (size_t j=0; j<meta::noise_generator_metadata::NUM_GENERATORS; ++j)
+                {
+                    if ((c->vMix[j] != 0.0f) && (vGenerators[j].bActive))
+                        c->vSources[c->nSources++]  = j;
+                }
+
+                // Set analyzer activity
+                bool fft_in_on          = (c->pFftIn  != NULL) ? c->pFftIn->value()  >= 0.5f : true;
+                bool fft_out_on         = (c->pFftOut != NULL) ? c->pFftOut->value() >= 0.5f : true;
+                sAnConfig.vEnabled[an_id++] = (fft_in)  && (fft_in_on)  && (c->bActive);
+                sAnConfig.vEnabled[an_id++] = (fft_out) && (fft_out_on) && (c->bActive);
+
+                // Update bypass
+                c->sBypass.set_bypass(bypass);
+            }
+
+            // Build the consumer set of each generator: the generator needs to be rendered only
+            // if it is mixed into some active channel with non-zero gain or is analyzed
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                for (size_t j=0; j<meta::noise_generator_metadata::NUM_GENERATORS; ++j)
+                {
+                    if (c->vMix[j] != 0.0f)
+                        vGenerators[j].nConsumers  |= GC_CHANNEL << i;
+                }
+            }
+
+            // Pass the configuration to the analyzer only if it has changed
+            if (!an_config_equal(&sAnConfig, &an_prev))
+                bAnDirty                = true;
+
+            // Query inline display redraw only if something shown there has changed: the inline
+            // display shows the frequency charts of generators and the bypass state only
+            if (redraw)
+                pWrapper->query_display_draw();
+        }
+
+        ssize_t noise_generator::extract_impulses(uint32_t *idx, float *amp, const float *src, size_t count, size_t limit)
+        {
+            size_t n = 0;
+            for (size_t i=0; i<count; ++i)
+            {
+                if (src[i] == 0.0f)
+                    continue;
+                if (n >= limit)
+                    return -1;
+
+                idx[n]      = i;
+                amp[n++]    = src[i];
+            }
+
+            return n;
+        }
+
+        void noise_generator::mix_generators(float *dst, const channel_t *c, size_t samples)
+        {
+            const float *src[meta::noise_generator::NUM_GENERATORS];
+            float k[meta::noise_generator::NUM_GENERATORS];
+            size_t n = 0;
+
+            // Collect dense sources
+            for (size_t i=0; i<c->nSources; ++i)
+            {
+                const size_t id         = c->vSources[i];
+                const generator_t *g    = &vGenerators[id];
+                if (g->nImpulses >= 0)
+                    continue;
+                src[n]                  = g->vBuffer;
+                k[n++]                  = c->vMix[id];
+            }
+
+            // Mix dense sources
+            switch (n)
+            {
+                case 0: dsp::fill_zero(dst, samples); break;
+                case 1:
+                    if (k[0] == GAIN_AMP_0_DB)
+                        dsp::copy(dst, src[0], samples);
+                    else
+                        dsp::mul_k3(dst, src[0], k[0], samples);
+                    break;
+                case 2: dsp::mix_copy2(dst, src[0], src[1], k[0], k[1], samples); break;
+                case 3: dsp::mix_copy3(dst, src[0], src[1], src[2], k[0], k[1], k[2], samples); break;
+                default:
+                    dsp::mix_copy4(dst, src[0], src[1], src[2], src[3], k[0], k[1], k[2], k[3], samples);
+                    break;
+            }
+
+            // Scatter-add sparse sources
+            for (size_t i=0; i<c->nSources; ++i)
+            {
+                const size_t id         = c->vSources[i];
+                const generator_t *g    = &vGenerators[id];
+                const float gain        = c->vMix[id];
+                if (g->nImpulses <= 0)
+                    continue;
+
+                for (ssize_t j=0; j<g->nImpulses; ++j)
+                    dst[g->vImpIdx[j]]     += g->vImpAmp[j] * gain;
+            }
+        }
+
+        void noise_generator::sync_cache(generator_t *g)
+        {
+            CacheRenderer *r    = g->pCache;
+            if (r == NULL)
+                return;
+            const bool fading   = g->nFadeDone < CACHE_XFADE;
+
+            // Swap the rendered table with the played one and crossfade to it. The previous
+            // table is passed back to the renderer for reuse.
+            if ((r->completed()) && (!fading))
+            {
+                if (r->successful())
+                {
+                    float *prev         = g->vCache;
+                    const size_t cap    = g->nCacheCap;
+
+                    g->vCache           = r->vData;
+                    g->nCacheSize       = r->nLength;
+                    g->nCacheCap        = r->nCapacity;
+                    r->vData            = prev;
+                    r->nCapacity        = cap;
+
+                    start_cache_segment(g, prev);
+                }
+                r->reset();
+                return;
+            }
+
+            // Launch rendering of the new table. The renderer reuses the back table which
+            // may be still faded out, so wait until the crossfade completes.
+            if ((g->bCached) && (g->bCacheDirty) && (!fading) && (r->idle()) && (pExecutor != NULL))
+            {
+                r->sParams          = g->sParams;
+                r->nSampleRate      = fSampleRate;
+                r->nSeed            = (bSeeded) ? g->nSeed : make_seed();
+                r->nLength          = g->nCacheLength;
+                if (pExecutor->submit(r))
+                    g->bCacheDirty      = false;
+            }
+        }
+
+        void noise_generator::start_cache_segment(generator_t *g, const float *prev)
+        {
+            // Fade out the current segment, the segment always has CACHE_XFADE samples to continue
+            g->vFadeData        = prev;
+            g->nFadePos         = g->nCachePos;
+            g->nFadeDone        = 0;
+
+            // Pick up a random segment which does not cross the end of the table
+            const size_t segment    = lsp_min(nCacheSegment, g->nCacheSize - CACHE_XFADE);
+            const size_t range      = g->nCacheSize - segment - CACHE_XFADE;
+            g->nCachePos        = lsp_min(size_t(g->sRandom.random(dspu::RND_LINEAR) * range), range);
+            g->nCacheLeft       = segment;
+        }
+
+        void noise_generator::play_cache(generator_t *g, float *dst, size_t samples)
+        {
+            while (samples > 0)
+            {
+                if (g->nCacheLeft == 0)
+                    start_cache_segment(g, g->vCache);
+
+                size_t to_do        = lsp_min(samples, g->nCacheLeft);
+                const float *src    = &g->vCache[g->nCachePos];
+                if (g->nFadeDone < CACHE_XFADE)
+                {
+                    // Crossfade with the previous segment, the table missing means silence
+                    to_do               = lsp_min(to_do, CACHE_XFADE - g->nFadeDone);
+                    dsp::mul3(dst, src, &vFadeIn[g->nFadeDone], to_do);
+                    if (g->vFadeData != NULL)
+                        dsp::fmadd3(dst, &g->vFadeData[g->nFadePos], &vFadeOut[g->nFadeDone], to_do);
+                    g->nFadePos        += to_do;
+                    g->nFadeDone       += to_do;
+                }
+                else
+                    dsp::copy(dst, src, to_do);
+
+                g->nCachePos       += to_do;
+                g->nCacheLeft      -= to_do;
+                dst                += to_do;
+                samples            -= to_do;
+            }
+        }
+
+        void noise_generator::reseed_generator(generator_t *g, uint32_t seed)
+        {
+            // Called from the audio thread. Seeding does not clear the state of the filters, so
+            // the engine which has rendered samples is replaced by the clean standby engine: then
+            // the stream is the same as after restart_generator(). The launcher re-creates the
+            // replaced engine, the reseed is postponed if it has not completed yet.
+            if (g->bRendered)
+            {
+                if (!g->bStandby)
+                {
+                    g->bReseed          = true;
+                    g->nReseed          = seed;
+                    return;
+                }
+
+                engine_t *e         = g->pEngine;
+                g->pEngine          = g->pStandby;
+                g->pStandby         = e;
+                g->bStandby         = false;
+                update_engine_sample_rate(g->pEngine, fSampleRate);
+                configure_engine(g->pEngine, &g->sParams, UPD_NOISE_ALL);
+
+                nEngineRequest     |= size_t(1) << (g - vGenerators);
+                nLaunch            |= LAUNCH_ENGINES;
+            }
+
+            reseed_engine(g->pEngine, seed);
+            g->sRandom.init(derive_seed(seed, 6));
+            g->nSeed            = seed;
+            g->nPosition        = 0;
+            g->nCacheLeft       = 0;
+            g->bRendered        = false;
+            g->bReseed          = false;
+        }
+
+        size_t noise_generator::init_standby(size_t mask)
+        {
+            // Executed by the launcher, the audio thread does not use the standby engine until it is ready
+            size_t done = 0;
+            for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
+            {
+                if (!(mask & (size_t(1) << i)))
+                    continue;
+
+                engine_t *e         = vGenerators[i].pStandby;
+                destroy_engine(e);
+                if (init_engine(e, 0))
+                    done               |= size_t(1) << i;
+                else
+                    destroy_engine(e);
+            }
+
+            return done;
+        }
+
+        bool noise_generator::restart_generator(generator_t *g, uint32_t seed, wsize_t position)
+        {
+            // Re-create the engine: seeding does not reset the state of all filters, so the exact
+            // replay of the stream requires the new engine. Should not be called from the audio thread
+            destroy_engine(g->pEngine);
+            if (!init_engine(g->pEngine, seed))
+            {
+                // The engine can not be used, keep the generator silent
+                destroy_engine(g->pEngine);
+                g->bValid           = false;
+                return false;
+            }
+            g->bValid           = true;
+            update_engine_sample_rate(g->pEngine, fSampleRate);
+            configure_engine(g->pEngine, &g->sParams, UPD_NOISE_ALL);
+
+            g->sRandom.init(derive_seed(seed, 6));
+            g->nSeed            = seed;
+            g->nPosition        = 0;
+            g->nCacheLeft       = 0;
+            g->bReseed          = false;
+
+            // The counter-based generator without filtering just moves to the position,
+            // otherwise replay the stream up to the requested position
+            const gen_params_t *p   = &g->sParams;
+            if ((p->nType == meta::noise_generator_metadata::NOISE_TYPE_COUNTER) &&
+                (p->enColor == dspu::NG_COLOR_WHITE) &&
+                (!p->bInaudible))
+            {
+                g->pEngine->sCounter.seek(position);
+                g->nPosition        = position;
+            }
+
+            while (g->nPosition < position)
+            {
+                const size_t to_do  = lsp_min(position - g->nPosition, wsize_t(nBlockSize));
+                render_engine(g->pEngine, &g->sParams, g->vBuffer, to_do);
+                g->nPosition       += to_do;
+            }
+            g->bRendered        = g->nPosition > 0;
+
+            return true;
+        }
+
+        bool noise_generator::snapshot(size_t index, snapshot_t *s) const
+        {
+            if ((index >= meta::noise_generator::NUM_GENERATORS) || (!bSeeded))
+                return false;
+
+            const generator_t *g    = &vGenerators[index];
+            if (g->bCached)
+                return false;
+
+            s->nSeed            = g->nSeed;
+            s->nPosition        = g->nPosition;
+            s->nSampleRate      = fSampleRate;
+            s->sParams          = g->sParams;
+
+            return true;
+        }
+
+        bool noise_generator::restore(size_t index, const snapshot_t *s)
+        {
+            if ((index >= meta::noise_generator::NUM_GENERATORS) || (!bSeeded))
+                return false;
+            if (s->nSampleRate != size_t(fSampleRate))
+                return false;
+
+            generator_t *g      = &vGenerators[index];
+            if (g->bCached)
+                return false;
+            if ((bStalled) && (!jobs_settled()))
+                return false;
+
+            g->sParams          = s->sParams;
+            return restart_generator(g, s->nSeed, s->nPosition);
+        }
+
+        void noise_generator::render_generator(generator_t *g, size_t samples)
+        {
+            float level     = GAIN_AMP_M_INF_DB;
+
+            if ((g->bActive) && (g->bValid) && ((g->nConsumers != 0) || (bUIActive)))
+            {
+                // The stages are measured separately, the analysis of the output is not measured
+                wsize_t ts      = (bMeasure) ? dsp_load::timestamp() : 0;
+
+                if ((g->bCached) && (g->vCache != NULL))
+                {
+                    play_cache(g, g->vBuffer, samples);
+                    if (bMeasure)
+                        g->sCacheLoad.measure(ts);
+                }
+                else
+                {
+                    generate_engine(g->pEngine, &g->sParams, g->vBuffer, samples);
+                    if (bMeasure)
+                        ts              = g->sGenLoad.measure(ts);
+                    filter_engine(g->pEngine, &g->sParams, g->vBuffer, samples);
+                    if (bMeasure)
+                        g->sInaLoad.measure(ts);
+                    g->nPosition   += samples;
+                    g->bRendered    = true;
+                }
+
+                // Try to represent the output as a list of impulses
+                g->nImpulses    = (g->bSparse) ?
+                    extract_impulses(g->vImpIdx, g->vImpAmp, g->vBuffer, samples, samples / SPARSE_DENSITY) : -1;
+                level           = (g->nImpulses >= 0) ?
+                    dsp::abs_max(g->vImpAmp, g->nImpulses) :
+                    dsp::abs_max(g->vBuffer, samples);
+                g->bFrozen      = false;
+            }
+            else if (!g->bFrozen)
+            {
+                // Nobody listens to the generator: its state is not observable, so
+                // just freeze it and clear the buffer only once
+                dsp::fill_zero(g->vBuffer, nBlockSize);
+                g->nImpulses    = 0;
+                g->bFrozen      = true;
+            }
+
+            g->fLevel       = lsp_max(g->fLevel, level);
+        }
+
+        template <noise_generator::ch_mode_t MODE>
+        void noise_generator::process_channel(channel_t *c, size_t samples)
+        {
+            c->vOutData             = (bDirect) ? c->vOut : c->vOutBuffer;
+            wsize_t ts              = (bMeasure) ? dsp_load::timestamp() : 0;
+
+            if (c->bActive)
+            {
+                // Apply input gain and measure the input level
+                dsp::mul_k3(c->vInBuffer, c->vIn, fGainIn * c->fGainIn, samples);
+                c->fLevelIn             = lsp_max(c->fLevelIn, dsp::abs_max(c->vInBuffer, samples));
+
+                // Mix generators and apply special mode to input
+                mix_generators(c->vOutData, c, samples);
+                if (MODE == CH_MODE_ADD)
+                    dsp::fmadd_k3(c->vOutData, c->vInBuffer, c->fMixIn, samples);
+                else if (MODE == CH_MODE_MULT)
+                    dsp::mul2(c->vOutData, c->vInBuffer, samples);
+
+                // Measure output level
+                c->fLevelOut            = lsp_max(c->fLevelOut, dsp::abs_max(c->vOutData, samples));
+            }
+            else if (MODE == CH_MODE_ADD)
+            {
+                // Muted channel mixes no generators, only the input signal passes in the add mode
+                dsp::mul_k3(c->vOutData, c->vIn, fGainIn * c->fGainIn * c->fMixIn, samples);
+            }
+            else
+                dsp::fill_zero(c->vOutData, samples);
+            if (bMeasure)
+                ts                      = c->sMixLoad.measure(ts);
+
+            // Post-process buffer. The input data is already saved in the temporary
+            // buffer, so it is safe to render directly even if input and output share memory
+            if (!bDirect)
+            {
+                c->sBypass.process(c->vOut, c->vIn, c->vOutData, samples);
+                if (bMeasure)
+                    c->sBypassLoad.measure(ts);
+            }
+        }
+
+        void noise_generator::pass_through(size_t samples)
+        {
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                if (c->vOut != c->vIn)
+                    dsp::copy(c->vOut, c->vIn, samples);
+            }
+        }
+
+        void noise_generator::process_channel(channel_t *c, size_t samples)
+        {
+            // The mode is checked once per block, the kernel is specialized for the mode
+            switch (c->enMode)
+            {
+                case CH_MODE_ADD:
+                    process_channel<CH_MODE_ADD>(c, samples);
+                    break;
+                case CH_MODE_MULT:
+                    process_channel<CH_MODE_MULT>(c, samples);
+                    break;
+                case CH_MODE_OVERWRITE:
+                default:
+                    process_channel<CH_MODE_OVERWRITE>(c, samples);
+                    break;
+            }
+        }
+
+        void noise_generator::process_channels(size_t samples)
+        {
+            for (size_t i=0; i<nChannels; ++i)
+                process_channel(&vChannels[i], samples);
+        }
+
+        void noise_generator::run_job(job_t *job)
+        {
+            switch (job->enType)
+            {
+                case JOB_GENERATOR:
+                    render_generator(&vGenerators[job->nIndex], job->nSamples);
+                    break;
+                case JOB_CHANNEL:
+                {
+                    process_channel(&vChannels[job->nIndex], job->nSamples);
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+
+        size_t noise_generator::claim_jobs()
+        {
+            size_t n = 0;
+            for (size_t i=0; i<MAX_JOBS; ++i)
+            {
+                // Check the state before the CAS to keep the cache line shared while polling
+                job_t *job      = &vJobs[i];
+                if (atomic_load(&job->nState) != uatomic_t(JOB_READY))
+                    continue;
+                if (!atomic_cas(&job->nState, uatomic_t(JOB_READY), uatomic_t(JOB_TAKEN)))
+                    continue;
+
+                run_job(job);
+                atomic_store(&job->nState, uatomic_t(JOB_DONE));
+                ++n;
+            }
+
+            return n;
+        }
+
+        bool noise_generator::execute_jobs(size_t first, size_t count)
+        {
+            // Publish jobs and execute them together with workers. The audio thread takes
+            // all jobs which are not started by workers yet
+            for (size_t i=first; i<first + count; ++i)
+                atomic_store(&vJobs[i].nState, uatomic_t(JOB_READY));
+            claim_jobs();
+
+            // The rest of jobs is being executed by workers. Poll for a while, then yield the CPU
+            // in case the worker has been preempted. The worker may not complete its job within
+            // the real-time duration of the block: then the job is left to it and the audio thread
+            // does not touch the DSP graph until the job completes, see jobs_settled()
+            const wsize_t deadline  = dsp_load::timestamp() + wsize_t((vJobs[first].nSamples * 1e+9f) / fSampleRate);
+            size_t polls = 0;
+            for (size_t i=first; i<first + count; ++i)
+            {
+                while (atomic_load(&vJobs[i].nState) != uatomic_t(JOB_DONE))
+                {
+                    if (((++polls) % JOB_CLOCK_PERIOD) == 0)
+                    {
+                        if (dsp_load::timestamp() >= deadline)
+                        {
+                            bStalled        = true;
+                            nSerialHold     = dspu::seconds_to_samples(fSampleRate, PARALLEL_BACKOFF);
+                            return false;
+                        }
+                    }
+
+                    if (polls < JOB_SPIN_COUNT)
+                        cpu_relax();
+                    else
+                        ipc::Thread::yield();
+                }
+            }
+
+            // Some worker has been late, render on the audio thread only for a while
+            if (polls >= JOB_SPIN_COUNT)
+                nSerialHold     = dspu::seconds_to_samples(fSampleRate, PARALLEL_BACKOFF);
+
+            return true;
+        }
+
+        bool noise_generator::jobs_settled()
+        {
+            // Check that workers have completed the jobs which missed the deadline
+            for (size_t i=0; i<MAX_JOBS; ++i)
+            {
+                if (atomic_load(&vJobs[i].nState) == uatomic_t(JOB_TAKEN))
+                    return false;
+            }
+
+            bStalled        = false;
+            return true;
+        }
+
+        void noise_generator::silence_output(size_t offset, size_t samples)
+        {
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                dsp::fill_zero(&c->vOut[offset], samples);
+            }
+        }
+
+        void noise_generator::start_workers()
+        {
+            // Executed by the launcher, the audio thread renders its own share of jobs
+            for (size_t i=nWorkers; i<meta::noise_generator::NUM_GENERATORS - 1; ++i)
+            {
+                Worker *w               = new Worker(this);
+                if (w == NULL)
+                    break;
+                if (w->start() != STATUS_OK)
+                {
+                    delete w;
+                    break;
+                }
+                vWorkers[nWorkers++]    = w;
+            }
+        }
+
+        void noise_generator::finish_launch()
+        {
+            // Take the resources allocated by the launcher
+            Launcher *l     = pLauncher;
+            if ((l != NULL) && (l->completed()))
+            {
+                const size_t done   = l->nDone;
+                if (done & LAUNCH_WORKERS)
+                    bWorkers        = nWorkers > 0;
+                if (done & LAUNCH_ANALYZER)
+                {
+                    bAnInit         = true;
+                    if (fSampleRate > 0)
+                        sAnalyzer.set_sample_rate(fSampleRate);
+                }
+                if (done & LAUNCH_ANALYSIS)
+                {
+                    pAnalysis       = l->pAnalysis;
+                    l->pAnalysis    = NULL;
+                }
+
+                // Enable the analysis with the allocated resources
+                if (done & (LAUNCH_ANALYZER | LAUNCH_ANALYSIS))
+                {
+                    sAnConfig.bActive   = (bFftOn) && (bAnInit);
+                    bAnThread           = (pAnalysis != NULL) && (bAnInit) && (bFftThread);
+                    bAnDirty            = true;
+                }
+
+                // Standby engines can be used for reseeding
+                if (done & LAUNCH_ENGINES)
+                {
+                    for (size_t i=0; i<meta::noise_generator::NUM_GENERATORS; ++i)
+                    {
+                        if (l->nEnginesDone & (size_t(1) << i))
+                            vGenerators[i].bStandby = true;
+                    }
+                }
+
+                // Bind larger buffers of the processing block, the replaced ones are freed by the launcher
+                if (done & LAUNCH_BUFFERS)
+                {
+                    block_t *b          = &l->sBlock;
+                    if (b->nSize > nBlockSize)
+                    {
+                        pBlockGarbage       = pBlockData;
+                        bind_block(b);
+                    }
+                    else
+                        pBlockGarbage       = b->pData;
+                    b->pData            = NULL;
+                    b->pPtr             = NULL;
+                    nLaunch            |= LAUNCH_FREE;
+                }
+
+                l->nRequest     = 0;
+                l->nDone        = 0;
+                l->reset();
+            }
+        }
+
+        void noise_generator::sync_launcher()
+        {
+            finish_launch();
+
+            // Each resource is requested only once
+            Launcher *l     = pLauncher;
+            if ((nLaunch != 0) && (l != NULL) && (l->idle()) && (pExecutor != NULL))
+            {
+                atomic_store(&l->nState, uatomic_t(LS_READY));
+                l->nRequest     = nLaunch;
+                l->sBlock.nSize = nBlockRequest;
+                l->pGarbage     = pBlockGarbage;
+                l->nEngines     = nEngineRequest;
+                if (pExecutor->submit(l))
+                {
+                    nLaunched      |= nLaunch & (~(LAUNCH_BUFFERS | LAUNCH_FREE | LAUNCH_ENGINES));
+                    nLaunch         = 0;
+                    pBlockGarbage   = NULL;
+                    nEngineRequest  = 0;
+                }
+                else
+                    l->pGarbage     = NULL;
+            }
+        }
+
+        size_t noise_generator::analysis_channels() const
+        {
+            return nChannels * 2 + meta::noise_generator::NUM_GENERATORS;
+        }
+
+        void noise_generator::apply_analysis(const an_config_t *cfg)
+        {
+            if (!bAnInit)
+                return;
+
+            if (cfg->bActive != sAnalyzer.activity())
+            {
+                sAnalyzer.reset();
+                sAnalyzer.set_activity(cfg->bActive);
+            }
+            sAnalyzer.set_reactivity(cfg->fReactivity);
+            sAnalyzer.set_shift(cfg->fShift);
+
+            const size_t an_channels    = analysis_channels();
+            for (size_t i=0; i<an_channels; ++i)
+                sAnalyzer.enable_channel(i, cfg->vEnabled[i]);
+        }
+
+        void noise_generator::publish_spectra(float *dst)
+        {
+            const size_t an_channels    = analysis_channels();
+            for (size_t i=0; i<an_channels; ++i, dst += meta::noise_generator::MESH_POINTS)
+                sAnalyzer.get_spectrum(i, dst, vIndexes, meta::noise_generator::MESH_POINTS);
+        }
+
+        void noise_generator::sync_analysis()
+        {
+            // The audio thread switches the owner from AN_DIRECT to AN_THREAD and from AN_THREAD to
+            // AN_RELEASE, the analysis thread switches it from AN_RELEASE to AN_DIRECT
+            const uatomic_t state       = atomic_load(&nAnState);
+            if (bAnThread)
+            {
+                if (state == AN_DIRECT)
+                {
+                    // Keep the current spectra on the meshes until the analysis thread publishes new ones
+                    apply_analysis(&sAnConfig);
+                    publish_spectra(&vAnSpectra[nAnFront * analysis_channels() * meta::noise_generator::MESH_POINTS]);
+                    sAnRing.clear();
+                    nAnFrame                    = 0;
+                    bAnDirty                    = false;
+                    atomic_store(&nAnState, uatomic_t(AN_THREAD));
+                }
+                else if ((state == AN_THREAD) && (bAnDirty) && (atomic_load(&nAnConfig) == 0))
+                {
+                    sAnShared                   = sAnConfig;
+                    bAnDirty                    = false;
+                    atomic_store(&nAnConfig, uatomic_t(1));
+                }
+            }
+            else if (state == AN_THREAD)
+            {
+                // The configuration is applied again as soon as the analyzer is returned
+                bAnDirty                    = true;
+                atomic_store(&nAnState, uatomic_t(AN_RELEASE));
+            }
+            else if ((state == AN_DIRECT) && (bAnDirty))
+            {
+                apply_analysis(&sAnConfig);
+                bAnDirty                    = false;
+            }
+
+            // Take the latest spectra published by the analysis thread
+            if (atomic_load(&nAnSwap) & ANALYSIS_FRESH)
+                nAnFront                    = atomic_swap(&nAnSwap, uatomic_t(nAnFront)) & ~ANALYSIS_FRESH;
+        }
+
+        void noise_generator::release_analysis()
+        {
+            if (atomic_load(&nAnState) == AN_THREAD)
+                atomic_store(&nAnState, uatomic_t(AN_RELEASE));
+            while (atomic_load(&nAnState) != AN_DIRECT)
+                ipc::Thread::sleep(1);
+            bAnDirty                    = true;
+        }
+
+        bool noise_generator::run_analysis()
+        {
+            const uatomic_t state       = atomic_load(&nAnState);
+            if (state == AN_RELEASE)
+            {
+                atomic_store(&nAnConfig, uatomic_t(0));
+                atomic_store(&nAnState, uatomic_t(AN_DIRECT));
+                return false;
+            }
+            else if (state != AN_THREAD)
+                return false;
+
+            // Apply the configuration passed by the audio thread
+            if (atomic_load(&nAnConfig) != 0)
+            {
+                apply_analysis(&sAnShared);
+                atomic_store(&nAnConfig, uatomic_t(0));
+            }
+
+            const size_t count          = sAnRing.pop(vAnBuffers, ANALYSIS_BLOCK_SIZE);
+            if (count <= 0)
+                return false;
+            if (sAnalyzer.activity())
+                sAnalyzer.process(vAnBuffers, count);
+
+            // Publish the spectra at the refresh rate of the analyzer
+            nAnFrame                   += count;
+            if (nAnFrame >= nAnPeriod)
+            {
+                nAnFrame                    = 0;
+                publish_spectra(&vAnSpectra[nAnBack * analysis_channels() * meta::noise_generator::MESH_POINTS]);
+                nAnBack                     = atomic_swap(&nAnSwap, uatomic_t(nAnBack | ANALYSIS_FRESH)) & ~ANALYSIS_FRESH;
+            }
+
+            return true;
+        }
+
+        void noise_generator::output_spectrum(float *dst, size_t channel, uatomic_t state)
+        {
+            if (!bAnInit)
+                dsp::fill_zero(dst, meta::noise_generator::MESH_POINTS);
+            else if (state == AN_DIRECT)
+                sAnalyzer.get_spectrum(channel, dst, vIndexes, meta::noise_generator::MESH_POINTS);
+            else
+                dsp::copy(
+                    dst,
+                    &vAnSpectra[(nAnFront * analysis_channels() + channel) * meta::noise_generator::MESH_POINTS],
+                    meta::noise_generator::MESH_POINTS);
+        }
+
+        void noise_generator::analytic_spectrum(float *dst, const generator_t *g) const
+        {
+            // The chart of the spectral generator is relative to 1 kHz, not to white noise of the same power
+            float k                     = g->fSigma * sAnConfig.fShift * fAnNorm;
+            if (g->sParams.nType == meta::noise_generator_metadata::NOISE_TYPE_SPECTRAL)
+                k                          *= g->pEngine->sSpectral.chart_gain();
+
+            for (size_t i=0; i<meta::noise_generator_metadata::MESH_POINTS; ++i)
+                dst[i]                      = g->vFreqChart[i] * vAnEnvelope[vIndexes[i]] * k;
+        }
+
+        bool noise_generator::chart_key_equal(const chart_key_t *a, const chart_key_t *b)
+        {
+            return
+                (a->enEngine == b->enEngine) &&
+                (a->enColor == b->enColor) &&
+                (a->enSlopeUnit == b->enSlopeUnit) &&
+                (a->fSlope == b->fSlope) &&
+                (a->nSampleRate == b->nSampleRate) &&
+                (a->bInaudible == b->bInaudible);
+        }
+
+        void noise_generator::measure_lcg_sigma(float *dst)
+        {
+            float buf[BUFFER_SIZE_DFL];
+            dspu::LCG lcg;
+            lcg.construct();
+            lcg.init(0);
+            lcg.set_amplitude(1.0f);
+            lcg.set_offset(0.0f);
+
+            for (size_t i=0; i<dspu::LCG_MAX; ++i)
+            {
+                lcg.set_distribution(dspu::lcg_dist_t(i));
+
+                // Deviation from the mean value of the distribution
+                double sum = 0.0, sqr_sum = 0.0;
+                for (size_t offset=0; offset<LCG_SIGMA_SAMPLES; offset += BUFFER_SIZE_DFL)
+                {
+                    lcg.process_overwrite(buf, BUFFER_SIZE_DFL);
+                    for (size_t j=0; j<BUFFER_SIZE_DFL; ++j)
+                    {
+                        sum        += buf[j];
+                        sqr_sum    += buf[j] * buf[j];
+                    }
+                }
 
-                // Set analyzer activity
-                bool fft_on         = (g->pFft != NULL) ? g->pFft->value() >= 0.5f : true;
-                sAnalyzer.enable_channel(an_id++, fft_gen && fft_on);
-
-                // Plots only really need update when we operate the controls, se we set the update to true
-                g->bUpdPlots        = true;
+                const double mean   = sum / LCG_SIGMA_SAMPLES;
+                dst[i]              = sqrt(lsp_max(sqr_sum / LCG_SIGMA_SAMPLES - mean * mean, 0.0));
             }
 
+            lcg.destroy();
+        }
 
-            // Update the configuration of each output channel
-            fGainIn                 = pGainIn->value();
-            fGainOut                = pGainOut->value();
+        bool noise_generator::an_config_equal(const an_config_t *a, const an_config_t *b)
+        {
+            if ((a->fReactivity != b->fReactivity) ||
+                (a->fShift != b->fShift) ||
+                (a->bActive != b->bActive))
+                return false;
 
-            for (size_t i=0; i<nChannels; ++i)
-            {
-                channel_t *c            = &vChannels[i];
-                bool solo               = (c->pSlSw != NULL) ? c->pSlSw->value() >= 0.5f : false;
-                bool mute               = (c->pMtSw != NULL) ? c->pMtSw->value() >= 0.5f : false;
+            const size_t count  = sizeof(a->vEnabled) / sizeof(a->vEnabled[0]);
+            for (size_t i=0; i<count; ++i)
+                if (a->vEnabled[i] != b->vEnabled[i])
+                    return false;
 
-                c->enMode               = get_channel_mode(c->pNoiseMode->value());
-                for (size_t j=0; j<meta::noise_generator_metadata::NUM_GENERATORS; ++j)
-                    c->vGain[j]             = c->pGain[j]->value();
-                c->fGainIn              = c->pGainIn->value();
-                c->fGainOut             = c->pGainOut->value();
-                c->bActive              = (c_has_solo) ? solo : !mute;
+            return true;
+        }
 
-                // Set analyzer activity
-                bool fft_in_on          = (c->pFftIn  != NULL) ? c->pFftIn->value()  >= 0.5f : true;
-                bool fft_out_on         = (c->pFftOut != NULL) ? c->pFftOut->value() >= 0.5f : true;
-                sAnalyzer.enable_channel(an_id++, fft_in  && fft_in_on );
-                sAnalyzer.enable_channel(an_id++, fft_out && fft_out_on);
+        void noise_generator::update_freq_chart(generator_t *g)
+        {
+            if ((!g->bActive) || (!g->bValid))
+            {
+                dsp::fill_zero(g->vFreqChart, meta::noise_generator_metadata::MESH_POINTS);
+                return;
+            }
 
-                // Update bypass
-                c->sBypass.set_bypass(bypass);
+            // Make the key of the chart, the slope matters for the arbitrary colour only
+            const gen_params_t *p   = &g->sParams;
+            chart_key_t key;
+            key.enEngine            =
+                (p->nType == meta::noise_generator_metadata::NOISE_TYPE_SPECTRAL) ? CHART_SPECTRAL :
+                (p->nType == meta::noise_generator_metadata::NOISE_TYPE_COUNTER) ? CHART_COUNTER :
+                CHART_GENERATOR;
+            key.enColor             = p->enColor;
+            key.enSlopeUnit         = (p->enColor == dspu::NG_COLOR_ARBITRARY) ? p->enSlopeUnit : dspu::STLT_SLOPE_UNIT_NEPER_PER_NEPER;
+            key.fSlope              = (p->enColor == dspu::NG_COLOR_ARBITRARY) ? p->fSlope : 0.0f;
+            key.nSampleRate         = fSampleRate;
+            key.bInaudible          = p->bInaudible;
+
+            // Lookup the cache, the least recently used chart is replaced on miss
+            chart_t *chart          = &vCharts[0];
+            for (size_t i=0; i<CHART_CACHE_SIZE; ++i)
+            {
+                chart_t *ch             = &vCharts[i];
+                if ((ch->bValid) && (chart_key_equal(&ch->sKey, &key)))
+                {
+                    ch->nAccess             = ++nChartClock;
+                    dsp::copy(g->vFreqChart, ch->vData, meta::noise_generator_metadata::MESH_POINTS);
+                    return;
+                }
+                if ((!ch->bValid) || ((chart->bValid) && (ch->nAccess < chart->nAccess)))
+                    chart                   = ch;
+            }
+
+            // Compute frequency characteristics
+            switch (key.enEngine)
+            {
+                case CHART_SPECTRAL:
+                    g->pEngine->sSpectral.freq_chart(chart->vData, vFreqs, meta::noise_generator_metadata::MESH_POINTS);
+                    break;
+                case CHART_COUNTER:
+                    if (key.enColor != dspu::NG_COLOR_WHITE)
+                    {
+                        g->pEngine->sCounterColor.freq_chart(vFreqChart, vFreqs, meta::noise_generator_metadata::MESH_POINTS);
+                        dsp::pcomplex_mod(chart->vData, vFreqChart, meta::noise_generator_metadata::MESH_POINTS);
+                    }
+                    else
+                        dsp::fill_one(chart->vData, meta::noise_generator_metadata::MESH_POINTS);
+                    break;
+                case CHART_GENERATOR:
+                default:
+                    g->pEngine->sNoiseGenerator.freq_chart(vFreqChart, vFreqs, meta::noise_generator_metadata::MESH_POINTS);
+                    dsp::pcomplex_mod(chart->vData, vFreqChart, meta::noise_generator_metadata::MESH_POINTS);
+                    break;
             }
 
-            // Query inline display redraw
-            pWrapper->query_display_draw();
+            chart->sKey             = key;
+            chart->nAccess          = ++nChartClock;
+            chart->bValid           = true;
+            dsp::copy(g->vFreqChart, chart->vData, meta::noise_generator_metadata::MESH_POINTS);
         }
 
         void noise_generator::process(size_t samples)
@@ -696,6 +2841,7 @@ namespace lsp
             size_t an_id;
             float *an_buffers[meta::noise_generator_metadata::CHANNELS_MAX * 2 +
                               meta::noise_generator_metadata::NUM_GENERATORS];
+            const wsize_t start = (bMeasure) ? dsp_load::timestamp() : 0;
 
             // Initialize buffer pointers
             for (size_t i=0; i<nChannels; ++i)
@@ -711,124 +2857,185 @@ namespace lsp
                     channel_t *c            = &vChannels[i];
                     c->vIn                  = NULL;
                     c->vOut                 = NULL;
+                    c->vOutData             = NULL;
                 }
             };
 
-            // Process data
-            for (size_t count = samples; count > 0;)
+            // Workers still execute the jobs which missed the deadline: keep away from the DSP graph
+            if ((bStalled) && (!jobs_settled()))
             {
-                size_t to_do    = lsp_min(count, BUFFER_SIZE);
+                silence_output(0, samples);
+                return;
+            }
+            if (bSettingsPending)
+                update_settings();
 
-                // Run each noise generator first to generate random noise sequences
-                for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
+            // The level meters of generators are the consumers only while the UI is visible
+            bUIActive           = ui_active();
+
+            // Meters show the peak level over all tiles of the block
+            for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
+                vGenerators[i].fLevel   = GAIN_AMP_M_INF_DB;
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                c->fLevelIn             = GAIN_AMP_M_INF_DB;
+                c->fLevelOut            = GAIN_AMP_M_INF_DB;
+            }
+
+            // Exchange noise tables with renderers and take resources from the launcher
+            for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
+                sync_cache(&vGenerators[i]);
+
+            // Remember the block length of the host and let the launcher grow buffers up to it,
+            // until then the blocks of the host are just split into several parts
+            nMaxBlock           = lsp_max(nMaxBlock, lsp_min(samples, size_t(BUFFER_SIZE)));
+            if ((nMaxBlock > nBlockSize) && (nMaxBlock > nBlockRequest))
+            {
+                nBlockRequest       = nMaxBlock;
+                nLaunch            |= LAUNCH_BUFFERS;
+            }
+            sync_launcher();
+
+            // Apply the postponed reseed once the standby engine is ready
+            for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
+            {
+                generator_t *g          = &vGenerators[i];
+                if ((g->bReseed) && (g->bStandby))
+                    reseed_generator(g, g->nReseed);
+            }
+
+            // Only the audio thread changes the owner of the analyzer from AN_DIRECT
+            sync_analysis();
+            const uatomic_t an_state    = atomic_load(&nAnState);
+
+            // Once the bypass crossfade has completed, the output does not depend on the DSP graph:
+            // put it to sleep and just pass the input through. The graph wakes up as soon as the bypass
+            // is switched off, so the crossfade back to the processed signal already carries live data
+            if ((bBypass) && (nBypassHold == 0))
+                pass_through(samples);
+            else
+            {
+                // Process data
+                for (size_t count = samples; count > 0;)
                 {
-                    generator_t *g  = &vGenerators[i];
-                    float level     = GAIN_AMP_M_INF_DB;
+                    size_t to_do    = lsp_min(count, nBlockSize);
+
+                    // Small blocks are processed faster than workers wake up, otherwise split the
+                    // block into tiles so that the output of generators is mixed while it is in the cache
+                    const bool parallel     = (bParallel) && (bWorkers) && (nSerialHold == 0) && (to_do >= PARALLEL_MIN_BLOCK);
+                    if ((!parallel) && (nTileSize > 0))
+                        to_do                   = lsp_min(to_do, nTileSize);
 
-                    if (g->bActive)
+                    // Run each noise generator first to generate random noise sequences
+                    if (parallel)
                     {
-                        g->sNoiseGenerator.process_overwrite(g->vBuffer, to_do);
-                        if (g->bInaudible)
+                        for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
                         {
-                            dsp::mul_k2(g->vBuffer, INA_ATTENUATION, to_do);
-                            g->sAudibleStop.process_overwrite(g->vBuffer, g->vBuffer, to_do);
+                            job_t *job              = &vJobs[i];
+                            job->enType             = JOB_GENERATOR;
+                            job->nIndex             = i;
+                            job->nSamples           = to_do;
+                        }
+                        if (!execute_jobs(0, meta::noise_generator_metadata::NUM_GENERATORS))
+                        {
+                            // The rest of the block is not rendered
+                            silence_output(samples - count, count);
+                            break;
                         }
-                        level           = dsp::abs_max(g->vBuffer, to_do);
                     }
                     else
-                        dsp::fill_zero(g->vBuffer, to_do);
-
-                    g->pMeterOut->set_value(level);
-                }
-
-                // Process each channel independently
-                for (size_t i=0; i<nChannels; ++i)
-                {
-                    channel_t *c            = &vChannels[i];
+                    {
+                        for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
+                            render_generator(&vGenerators[i], to_do);
+                    }
 
-                    // Apply input gain and measure the input level
-                    dsp::mul_k3(c->vInBuffer, c->vIn, fGainIn * c->fGainIn, to_do);
-                    float level             = dsp::abs_max(c->vInBuffer, to_do);
-                    c->pMeterIn->set_value(level);
+                    // When the bypass is settled off, render directly to the output buffer
+                    bDirect                 = (!bBypass) && (nBypassHold == 0);
 
-                    // Apply matrix to the temporary buffer
-                    dsp::fill_zero(c->vOutBuffer, to_do);
-                    if (c->bActive)
+                    // Process each channel independently
+                    if (parallel)
                     {
-                        // Apply gain of each generator to the output buffer
-                        for (size_t j=0; j<meta::noise_generator_metadata::NUM_GENERATORS; ++j)
+                        // Channel jobs use their own slots, so the slot of the late job tells what it holds
+                        for (size_t i=0; i<nChannels; ++i)
+                        {
+                            job_t *job              = &vJobs[meta::noise_generator_metadata::NUM_GENERATORS + i];
+                            job->enType             = JOB_CHANNEL;
+                            job->nIndex             = i;
+                            job->nSamples           = to_do;
+                        }
+                        if (!execute_jobs(meta::noise_generator_metadata::NUM_GENERATORS, nChannels))
                         {
-                            generator_t *g      = &vGenerators[j];
-                            dsp::fmadd_k3(c->vOutBuffer, g->vBuffer, c->vGain[j] * c->fGainOut, to_do);
+                            // The late channel job still writes its part, the rest of the block is not rendered
+                            if (count > to_do)
+                                silence_output(samples - count + to_do, count - to_do);
+                            break;
                         }
                     }
+                    else
+                        process_channels(to_do);
 
-                    // Now we have mixed output from generators, apply special mode to input
-                    switch (c->enMode)
+                    // Bind buffer pointers and pass for the analysis
+                    an_id = 0;
+                    for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
                     {
-                        case CH_MODE_ADD:   dsp::fmadd_k3(c->vOutBuffer, c->vInBuffer, c->fGainOut, to_do); break;
-                        case CH_MODE_MULT:  dsp::fmmul_k3(c->vOutBuffer, c->vInBuffer, c->fGainOut, to_do); break;
-                        case CH_MODE_OVERWRITE:
-                        default:
-                            break;
+                        generator_t *g          = &vGenerators[i];
+                        an_buffers[an_id++]     = g->vBuffer;
+                    }
+                    for (size_t i=0; i<nChannels; ++i)
+                    {
+                        channel_t *c            = &vChannels[i];
+                        an_buffers[an_id++]     = c->vInBuffer;
+                        an_buffers[an_id++]     = c->vOutData;
                     }
 
-                    // Apply output gain and measure output level
-                    dsp::mul_k2(c->vOutBuffer, fGainOut, to_do);
-                    level                   = dsp::abs_max(c->vOutBuffer, to_do);
-                    c->pMeterOut->set_value(level);
-
-                    // Post-process buffer
-                    c->sBypass.process(c->vOut, c->vIn, c->vOutBuffer, to_do);
-                }
-
-                // Bind buffer pointers and pass for the analysis
-                an_id = 0;
-                for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
-                {
-                    generator_t *g          = &vGenerators[i];
-                    an_buffers[an_id++]     = g->vBuffer;
-                }
-                for (size_t i=0; i<nChannels; ++i)
-                {
-                    channel_t *c            = &vChannels[i];
-                    an_buffers[an_id++]     = c->vInBuffer;
-                    an_buffers[an_id++]     = c->vOutBuffer;
-                }
-
-                if (sAnalyzer.activity())
-                    sAnalyzer.process(an_buffers, to_do);
+                    const wsize_t an_start  = (bMeasure) ? dsp_load::timestamp() : 0;
+                    if (an_state == AN_DIRECT)
+                    {
+                        if (sAnalyzer.activity())
+                            sAnalyzer.process(an_buffers, to_do);
+                    }
+                    else if ((an_state == AN_THREAD) && (sAnConfig.bActive))
+                        sAnRing.push(an_buffers, to_do);
+                    if (bMeasure)
+                        sAnLoad.measure(an_start);
 
-                // Update counter and pointers
-                for (size_t i=0; i<nChannels; ++i)
-                {
-                    channel_t *c            = &vChannels[i];
-                    c->vIn                 += to_do;
-                    c->vOut                += to_do;
+                    // Update counter and pointers
+                    for (size_t i=0; i<nChannels; ++i)
+                    {
+                        channel_t *c            = &vChannels[i];
+                        c->vIn                 += to_do;
+                        c->vOut                += to_do;
+                    }
+                    nBypassHold            -= lsp_min(nBypassHold, to_do);
+                    nSerialHold            -= lsp_min(nSerialHold, to_do);
+                    count                  -= to_do;
                 }
-                count                  -= to_do;
             }
 
             // Process each generator independently
+            bool charts_changed = false;
             an_id   = 0;
             for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
             {
                 generator_t *g      = &vGenerators[i];
+                g->pMeterOut->set_value(g->fLevel);
 
                 // Make a Frequency Chart - It only needs to be updated when the settings changed. so if bUpdPlots is true.
                 // We do the chart after processing so that we chart the most up to date filter state.
-                plug::mesh_t *mesh = g->pMsh->buffer<plug::mesh_t>();
-                if ((g->bUpdPlots) && (mesh != NULL) && (mesh->isEmpty()))
+                // The engine may be still used by the worker which missed the deadline.
+                if ((g->bUpdPlots) && (!bStalled))
                 {
-                    // Compute frequency characteristics
-                    if (g->bActive)
-                    {
-                        g->sNoiseGenerator.freq_chart(vFreqChart, vFreqs, meta::noise_generator_metadata::MESH_POINTS);
-                        dsp::pcomplex_mod(g->vFreqChart, vFreqChart, meta::noise_generator_metadata::MESH_POINTS);
-                    }
-                    else
-                        dsp::fill_zero(g->vFreqChart, meta::noise_generator_metadata::MESH_POINTS);
+                    update_freq_chart(g);
+                    charts_changed      = true;
+                    g->bUpdPlots        = false;
+                    g->bSyncChart       = true;
+                }
 
+                // The chart is also used for the analytic spectrum, so it is computed regardless of the mesh state
+                plug::mesh_t *mesh = g->pMsh->buffer<plug::mesh_t>();
+                if ((g->bSyncChart) && (mesh != NULL) && (mesh->isEmpty()))
+                {
                     // Commit frequency characteristics to output mesh
                     dsp::copy(&mesh->pvData[0][2], vFreqs, meta::noise_generator_metadata::MESH_POINTS);
                     dsp::copy(&mesh->pvData[1][2], g->vFreqChart, meta::noise_generator_metadata::MESH_POINTS);
@@ -847,7 +3054,7 @@ namespace lsp
                     mesh->data(2, meta::noise_generator_metadata::MESH_POINTS + 4);
 
                     // Update state only
-                    g->bUpdPlots = false;
+                    g->bSyncChart       = false;
                 }
 
                 size_t an_channel   = an_id++;
@@ -855,14 +3062,23 @@ namespace lsp
                 if ((mesh != NULL) && (mesh->isEmpty()))
                 {
                     dsp::copy(mesh->pvData[0], vFreqs, meta::noise_generator_metadata::MESH_POINTS);
-                    sAnalyzer.get_spectrum(an_channel, mesh->pvData[1], vIndexes, meta::noise_generator_metadata::MESH_POINTS);
+                    if (g->bAnalytic)
+                        analytic_spectrum(mesh->pvData[1], g);
+                    else
+                        output_spectrum(mesh->pvData[1], an_channel, an_state);
                     mesh->data(2, meta::noise_generator_metadata::MESH_POINTS);
                 }
             } // for channels
 
+            if (charts_changed)
+                publish_charts();
+
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t *c    = &vChannels[i];
+                c->pMeterIn->set_value(c->fLevelIn);
+                c->pMeterOut->set_value(c->fLevelOut);
+
                 for (size_t j=0; j<2; ++j)
                 {
                     plug::IPort *p      = (j > 0) ? c->pSpectrumOut : c->pSpectrumIn;
@@ -872,58 +3088,100 @@ namespace lsp
                     if ((mesh != NULL) && (mesh->isEmpty()))
                     {
                         dsp::copy(mesh->pvData[0], vFreqs, meta::noise_generator_metadata::MESH_POINTS);
-                        sAnalyzer.get_spectrum(an_channel, mesh->pvData[1], vIndexes, meta::noise_generator_metadata::MESH_POINTS);
+                        output_spectrum(mesh->pvData[1], an_channel, an_state);
                         mesh->data(2, meta::noise_generator_metadata::MESH_POINTS);
                     }
                 }
             }
+
+            if (bMeasure)
+                sTotalLoad.measure(start);
+            commit_loads(samples);
         }
 
-        bool noise_generator::inline_display(plug::ICanvas *cv, size_t width, size_t height)
+        void noise_generator::commit_loads(size_t samples)
         {
-            // Check proportions
-            if (height > width)
-                height  = width;
-
-            // Init canvas
-            if (!cv->init(width, height))
-                return false;
-            width       = cv->width();
-            height      = cv->height();
+            if (!bMeasure)
+            {
+                for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
+                    vGenerators[i].pLoad->set_value(0.0f);
+                for (size_t i=0; i<nChannels; ++i)
+                    vChannels[i].pLoad->set_value(0.0f);
+                pLoad->set_value(0.0f);
+                return;
+            }
 
-            // Clear background
-            bool bypassing = vChannels[0].sBypass.bypassing();
-            cv->set_color_rgb((bypassing) ? CV_DISABLED : CV_BACKGROUND);
-            cv->paint();
+            // The load is the ratio between the processing time and the real-time duration of the block
+            const float period  = (fSampleRate > 0) ? (samples * 1e+9f) / fSampleRate : 0.0f;
 
-            // Draw axis
-            cv->set_line_width(1.0);
-            float zx    = 1.0f/SPEC_FREQ_MIN;
-            float zy    = GAIN_AMP_P_48_DB;
-            float dx    = width/logf(SPEC_FREQ_MAX/SPEC_FREQ_MIN);
-            float dy    = height/logf(GAIN_AMP_M_48_DB/GAIN_AMP_P_48_DB);
+            for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
+            {
+                generator_t *g      = &vGenerators[i];
+                g->sGenLoad.commit(period);
+                g->sInaLoad.commit(period);
+                g->sCacheLoad.commit(period);
+                g->pLoad->set_value((g->sGenLoad.last() + g->sInaLoad.last() + g->sCacheLoad.last()) * 100.0f);
+            }
 
-            // Draw vertical lines
-            cv->set_color_rgb(CV_YELLOW, 0.5f);
-            for (float i=100.0f; i<SPEC_FREQ_MAX; i *= 10.0f)
+            for (size_t i=0; i<nChannels; ++i)
             {
-                float ax = dx*(logf(i*zx));
-                cv->line(ax, 0, ax, height);
+                channel_t *c        = &vChannels[i];
+                c->sMixLoad.commit(period);
+                c->sBypassLoad.commit(period);
+                c->pLoad->set_value((c->sMixLoad.last() + c->sBypassLoad.last()) * 100.0f);
             }
 
-            // Draw horizontal lines
-            cv->set_color_rgb(CV_WHITE, 0.5f);
-            for (float i=GAIN_AMP_M_48_DB; i<GAIN_AMP_P_48_DB; i *= GAIN_AMP_P_12_DB)
+            sAnLoad.commit(period);
+            sTotalLoad.commit(period);
+            pLoad->set_value(sTotalLoad.last() * 100.0f);
+        }
+
+        void noise_generator::publish_charts()
+        {
+            chart_frame_t *f        = &vChartFrames[nChartBack];
+            f->nVersion             = ++nChartVersion;
+            for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
             {
-                float ay = height + dy*(logf(i*zy));
-                cv->line(0, ay, width, ay);
+                const generator_t *g    = &vGenerators[i];
+                f->vActive[i]           = g->bActive;
+                dsp::copy(f->vData[i], g->vFreqChart, meta::noise_generator_metadata::MESH_POINTS);
             }
 
+            // Exchange the written frame with the published one
+            nChartBack              = atomic_swap(&nChartSwap, uatomic_t(nChartBack | CHART_FRESH)) & ~CHART_FRESH;
+        }
+
+        bool noise_generator::update_display_geometry(size_t width, size_t height)
+        {
+            const size_t sample_rate    = fSampleRate;
+            if ((pIDisplay != NULL) &&
+                (width == nIDisplayWidth) &&
+                (height == nIDisplayHeight) &&
+                (sample_rate == nIDisplayRate))
+                return true;
+
             // Allocate buffer: f, amp, x, y
             pIDisplay           = core::IDBuffer::reuse(pIDisplay, 4, width+4);
             core::IDBuffer *b   = pIDisplay;
             if (b == NULL)
                 return false;
+            uint32_t *idx       = static_cast<uint32_t *>(realloc(vIDisplayIdx, width * sizeof(uint32_t)));
+            if (idx == NULL)
+                return false;
+            vIDisplayIdx        = idx;
+
+            float zx    = 1.0f/SPEC_FREQ_MIN;
+            float zy    = GAIN_AMP_P_48_DB;
+            float dx    = width/logf(SPEC_FREQ_MAX/SPEC_FREQ_MIN);
+            float dy    = height/logf(GAIN_AMP_M_48_DB/GAIN_AMP_P_48_DB);
+
+            // Positions of grid lines
+            nIDisplayGridX      = 0;
+            for (float i=100.0f; i<SPEC_FREQ_MAX; i *= 10.0f)
+                vIDisplayGridX[nIDisplayGridX++]    = dx*(logf(i*zx));
+            nIDisplayGridY      = 0;
+            for (float i=GAIN_AMP_M_48_DB; i<GAIN_AMP_P_48_DB; i *= GAIN_AMP_P_12_DB)
+                vIDisplayGridY[nIDisplayGridY++]    = height + dy*(logf(i*zy));
 
             // Initialize mesh
             b->v[0][0]          = SPEC_FREQ_MIN*0.5f;
@@ -936,33 +3194,86 @@ namespace lsp
             b->v[1][width+2]    = GAIN_AMP_0_DB;
             b->v[1][width+3]    = GAIN_AMP_0_DB;
 
-            // Draw channels
-            Color col(CV_MESH);
-            bool aa = cv->set_anti_aliasing(true);
-            lsp_finally { cv->set_anti_aliasing(aa); };
-            cv->set_line_width(2);
-
             // Perform frequency decimation
-            for (size_t j=0; j<width; ++j)
+            for (size_t j=0, k=0; j<width; ++j, k += meta::noise_generator_metadata::MESH_POINTS)
             {
-                size_t k        = (j*meta::noise_generator_metadata::MESH_POINTS)/width;
-                b->v[0][j+2]    = vFreqs[k];
+                vIDisplayIdx[j]     = k / width;
+                b->v[0][j+2]        = vFreqs[vIDisplayIdx[j]];
             }
             dsp::fill_zero(b->v[2], width + 4);
             dsp::axis_apply_log1(b->v[2], b->v[0], zx, dx, width + 4);
 
+            nIDisplayWidth      = width;
+            nIDisplayHeight     = height;
+            nIDisplayRate       = sample_rate;
+            bIDisplayValid      = false;
+
+            return true;
+        }
+
+        bool noise_generator::inline_display(plug::ICanvas *cv, size_t width, size_t height)
+        {
+            // Check proportions
+            if (height > width)
+                height  = width;
+
+            // Init canvas
+            if (!cv->init(width, height))
+                return false;
+            width       = cv->width();
+            height      = cv->height();
+
+            // The canvas keeps the previous picture, so skip drawing if nothing has changed. The
+            // picture is drawn again on the canvas of another size or on another canvas
+            bool bypassing          = vChannels[0].sBypass.bypassing();
+            const bool act          = active();
+            if (atomic_load(&nChartSwap) & CHART_FRESH)
+                nChartFront             = atomic_swap(&nChartSwap, uatomic_t(nChartFront)) & ~CHART_FRESH;
+            const chart_frame_t *f  = &vChartFrames[nChartFront];
+            if (!update_display_geometry(width, height))
+                return false;
+            if ((bIDisplayValid) &&
+                (cv == pIDisplayCanvas) &&
+                (f->nVersion == nIDisplayVersion) &&
+                (bypassing == bIDisplayBypass) &&
+                (act == bIDisplayActive))
+                return true;
+
+            // Clear background
+            cv->set_color_rgb((bypassing) ? CV_DISABLED : CV_BACKGROUND);
+            cv->paint();
+
+            // Draw axis
+            cv->set_line_width(1.0);
+            float zy    = GAIN_AMP_P_48_DB;
+            float dy    = height/logf(GAIN_AMP_M_48_DB/GAIN_AMP_P_48_DB);
+
+            // Draw vertical lines
+            cv->set_color_rgb(CV_YELLOW, 0.5f);
+            for (size_t i=0; i<nIDisplayGridX; ++i)
+                cv->line(vIDisplayGridX[i], 0, vIDisplayGridX[i], height);
+
+            // Draw horizontal lines
+            cv->set_color_rgb(CV_WHITE, 0.5f);
+            for (size_t i=0; i<nIDisplayGridY; ++i)
+                cv->line(0, vIDisplayGridY[i], width, vIDisplayGridY[i]);
+
+            // Draw channels
+            core::IDBuffer *b   = pIDisplay;
+            Color col(CV_MESH);
+            bool aa = cv->set_anti_aliasing(true);
+            lsp_finally { cv->set_anti_aliasing(aa); };
+            cv->set_line_width(2);
+
             for (size_t i=0; i<meta::noise_generator_metadata::NUM_GENERATORS; ++i)
             {
-                generator_t *g  = &vGenerators[i];
-                if (!g->bActive)
+                if (!f->vActive[i])
                     continue;
 
                 // Perform amplitude decimation
+                const float *chart  = f->vData[i];
                 for (size_t j=0; j<width; ++j)
-                {
-                    size_t k        = (j*meta::noise_generator_metadata::MESH_POINTS)/width;
-                    b->v[1][j+2]    = g->vFreqChart[k];
-                }
+                    b->v[1][j+2]    = chart[vIDisplayIdx[j]];
                 b->v[1][1]      = b->v[1][2];
                 b->v[1][width+2]= b->v[1][width+1];
 
@@ -971,14 +3282,68 @@ namespace lsp
 
                 // Draw mesh
                 col.hue(float(i) / float(meta::noise_generator_metadata::NUM_GENERATORS));
-                uint32_t color = (bypassing || !(active())) ? CV_SILVER : col.rgb24();
+                uint32_t color = (bypassing || !(act)) ? CV_SILVER : col.rgb24();
                 Color stroke(color), fill(color, 0.5f);
                 cv->draw_poly(b->v[2], b->v[3], width+4, stroke, fill);
             }
 
+            nIDisplayVersion    = f->nVersion;
+            pIDisplayCanvas     = cv;
+            bIDisplayBypass     = bypassing;
+            bIDisplayActive     = act;
+            bIDisplayValid      = true;
+
             return true;
         }
 
+        void noise_generator::dump_engine(dspu::IStateDumper *v, const char *name, const engine_t *e)
+        {
+            v->begin_object(name, e, sizeof(engine_t));
+            {
+                v->write_object("sNoiseGenerator", &e->sNoiseGenerator);
+                v->write_object("sAudibleStop", &e->sAudibleStop);
+                v->write_object("sAudibleStopCheb", &e->sAudibleStopCheb);
+                v->write_object("sSpectral", &e->sSpectral);
+                v->write_object("sCounter", &e->sCounter);
+                v->write_object("sCounterColor", &e->sCounterColor);
+            }
+            v->end_object();
+        }
+
+        void noise_generator::dump_params(dspu::IStateDumper *v, const char *name, const gen_params_t *p)
+        {
+            v->begin_object(name, p, sizeof(gen_params_t));
+            {
+                v->write("nType", p->nType);
+                v->write("enLCGDist", size_t(p->enLCGDist));
+                v->write("enVelvetType", size_t(p->enVelvetType));
+                v->write("fVelvetWin", p->fVelvetWin);
+                v->write("fVelvetARNd", p->fVelvetARNd);
+                v->write("bVelvetCrush", p->bVelvetCrush);
+                v->write("fVelvetCrushProb", p->fVelvetCrushProb);
+                v->write("enColor", size_t(p->enColor));
+                v->write("enSlopeUnit", size_t(p->enSlopeUnit));
+                v->write("fSlope", p->fSlope);
+                v->write("fAmplitude", p->fAmplitude);
+                v->write("fOffset", p->fOffset);
+                v->write("bInaudible", p->bInaudible);
+                v->write("enInaFilter", size_t(p->enInaFilter));
+            }
+            v->end_object();
+        }
+
+        void noise_generator::dump_analysis(dspu::IStateDumper *v, const char *name, const an_config_t *cfg)
+        {
+            v->begin_object(name, cfg, sizeof(an_config_t));
+            {
+                v->write("fReactivity", cfg->fReactivity);
+                v->write("fShift", cfg->fShift);
+                v->write("bActive", cfg->bActive);
+                v->writev("vEnabled", cfg->vEnabled, MAX_AN_CHANNELS);
+            }
+            v->end_object();
+        }
+
         void noise_generator::dump(dspu::IStateDumper *v) const
         {
             // Write generators
@@ -991,16 +3356,67 @@ namespace lsp
 
                     v->begin_object(g, sizeof(generator_t));
                     {
-                        v->write_object("sNoiseGenerator", &g->sNoiseGenerator);
-                        v->write_object("sAudibleStop", &g->sAudibleStop);
+                        dump_engine(v, "pEngine", g->pEngine);
+                        dump_engine(v, "pStandby", g->pStandby);
+                        v->write("bStandby", g->bStandby);
+                        v->write("bRendered", g->bRendered);
+                        v->write("bReseed", g->bReseed);
+                        v->write("nReseed", g->nReseed);
+                        v->write_object("sRandom", &g->sRandom);
+                        v->write_object("sGenLoad", &g->sGenLoad);
+                        v->write_object("sInaLoad", &g->sInaLoad);
+                        v->write_object("sCacheLoad", &g->sCacheLoad);
+                        const CacheRenderer *r  = g->pCache;
+                        if (r != NULL)
+                        {
+                            v->begin_object("pCache", r, sizeof(CacheRenderer));
+                            {
+                                dump_engine(v, "sEngine", &r->sEngine);
+                                dump_params(v, "sParams", &r->sParams);
+                                v->write("nSampleRate", r->nSampleRate);
+                                v->write("nSeed", r->nSeed);
+                                v->write("nLength", r->nLength);
+                                v->write("nCapacity", r->nCapacity);
+                                v->write("vData", r->vData);
+                            }
+                            v->end_object();
+                        }
+                        else
+                            v->write("pCache", r);
 
+                        dump_params(v, "sParams", &g->sParams);
                         v->write("fGain", g->fGain);
                         v->write("bActive", g->bActive);
-                        v->write("bInaudible", g->bInaudible);
                         v->write("bUpdPlots", g->bUpdPlots);
+                        v->write("bSyncChart", g->bSyncChart);
+                        v->write("bAnalytic", g->bAnalytic);
+                        v->write("fSigma", g->fSigma);
+                        v->write("bFrozen", g->bFrozen);
+                        v->write("bValid", g->bValid);
+                        v->write("fLevel", g->fLevel);
+                        v->write("bSparse", g->bSparse);
+                        v->write("nImpulses", g->nImpulses);
+                        v->write("nConsumers", g->nConsumers);
+                        v->write("nUpdate", g->nUpdate);
+                        v->write("nSeed", g->nSeed);
+                        v->write("nPosition", g->nPosition);
+
+                        v->write("bCached", g->bCached);
+                        v->write("bCacheDirty", g->bCacheDirty);
+                        v->write("nCacheLength", g->nCacheLength);
+                        v->write("nCacheSize", g->nCacheSize);
+                        v->write("nCacheCap", g->nCacheCap);
+                        v->write("nCachePos", g->nCachePos);
+                        v->write("nCacheLeft", g->nCacheLeft);
+                        v->write("nFadePos", g->nFadePos);
+                        v->write("nFadeDone", g->nFadeDone);
+                        v->write("vCache", g->vCache);
+                        v->write("vFadeData", g->vFadeData);
 
                         v->write("vBuffer", g->vBuffer);
                         v->write("vFreqChart", g->vFreqChart);
+                        v->write("vImpIdx", g->vImpIdx);
+                        v->write("vImpAmp", g->vImpAmp);
 
                         v->write("pNoiseType", g->pNoiseType);
                         v->write("pAmplitude", g->pAmplitude);
@@ -1008,6 +3424,10 @@ namespace lsp
                         v->write("pSlSw", g->pSlSw);
                         v->write("pMtSw", g->pMtSw);
                         v->write("pInaSw", g->pInaSw);
+                        v->write("pInaFilter", g->pInaFilter);
+                        v->write("pCached", g->pCached);
+                        v->write("pCacheLen", g->pCacheLen);
+                        v->write("pSeed", g->pSeed);
                         v->write("pLCGdist", g->pLCGdist);
                         v->write("pVelvetType", g->pVelvetType);
                         v->write("pVelvetWin", g->pVelvetWin);
@@ -1020,6 +3440,7 @@ namespace lsp
                         v->write("pCslopeDBD", g->pCslopeDBD);
                         v->write("pFft", g->pFft);
                         v->write("pMeterOut", g->pMeterOut);
+                        v->write("pLoad", g->pLoad);
                         v->write("pMsh", g->pMsh);
                         v->write("pSpectrum", g->pSpectrum);
                     }
@@ -1030,6 +3451,76 @@ namespace lsp
 
             // Write analyzer object
             v->write_object("sAnalyzer", &sAnalyzer);
+            v->write_object("sAnRing", &sAnRing);
+            dump_analysis(v, "sAnConfig", &sAnConfig);
+            dump_analysis(v, "sAnShared", &sAnShared);
+            v->write("pAnalysis", pAnalysis);
+            v->write("nAnState", nAnState);
+            v->write("nAnConfig", nAnConfig);
+            v->write("nAnSwap", nAnSwap);
+            v->write("nAnFront", nAnFront);
+            v->write("nAnBack", nAnBack);
+            v->write("nAnPeriod", nAnPeriod);
+            v->write("nAnFrame", nAnFrame);
+            v->write("bAnThread", bAnThread);
+            v->write("bFftOn", bFftOn);
+            v->write("bFftThread", bFftThread);
+            v->write("bAnDirty", bAnDirty);
+            v->writev("vAnBuffers", vAnBuffers, MAX_AN_CHANNELS);
+            v->write("vAnSpectra", vAnSpectra);
+            v->write("vAnEnvelope", vAnEnvelope);
+            v->begin_array("vCharts", vCharts, CHART_CACHE_SIZE);
+            {
+                for (size_t i=0; i<CHART_CACHE_SIZE; ++i)
+                {
+                    const chart_t *ch   = &vCharts[i];
+                    v->begin_object(ch, sizeof(chart_t));
+                    {
+                        v->write("enEngine", size_t(ch->sKey.enEngine));
+                        v->write("enColor", size_t(ch->sKey.enColor));
+                        v->write("enSlopeUnit", size_t(ch->sKey.enSlopeUnit));
+                        v->write("fSlope", ch->sKey.fSlope);
+                        v->write("nSampleRate", ch->sKey.nSampleRate);
+                        v->write("bInaudible", ch->sKey.bInaudible);
+                        v->write("nAccess", ch->nAccess);
+                        v->write("bValid", ch->bValid);
+                        v->write("vData", ch->vData);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+            v->write("nChartClock", nChartClock);
+            v->write("fAnNorm", fAnNorm);
+            v->writev("vLCGSigma", vLCGSigma, dspu::LCG_MAX);
+            v->write("pExecutor", pExecutor);
+            v->writev("vWorkers", vWorkers, meta::noise_generator::NUM_GENERATORS - 1);
+            v->write("nWorkers", nWorkers);
+            v->write("pLauncher", pLauncher);
+            v->write("nLaunch", nLaunch);
+            v->write("nLaunched", nLaunched);
+            v->write("nEngineRequest", nEngineRequest);
+            v->write("bWorkers", bWorkers);
+            v->write("nParallel", nParallel);
+            v->write("nSerialHold", nSerialHold);
+            v->write("bStalled", bStalled);
+            v->write("bSettingsPending", bSettingsPending);
+            v->begin_array("vJobs", vJobs, MAX_JOBS);
+            {
+                for (size_t i=0; i<MAX_JOBS; ++i)
+                {
+                    const job_t *job    = &vJobs[i];
+                    v->begin_object(job, sizeof(job_t));
+                    {
+                        v->write("nState", job->nState);
+                        v->write("enType", size_t(job->enType));
+                        v->write("nIndex", job->nIndex);
+                        v->write("nSamples", job->nSamples);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
 
             // It is very useful to dump plugin state for debug purposes
             v->write("nChannels", nChannels);
@@ -1043,16 +3534,26 @@ namespace lsp
                     v->begin_object(c, sizeof(channel_t));
                     {
                         v->write_object("sBypass", &c->sBypass);
+                        v->write_object("sMixLoad", &c->sMixLoad);
+                        v->write_object("sBypassLoad", &c->sBypassLoad);
 
                         v->write("enMode", size_t(c->enMode));
                         v->writev("vGain", c->vGain, meta::noise_generator::NUM_GENERATORS);
                         v->write("fGainIn", c->fGainIn);
                         v->write("fGainOut", c->fGainOut);
+                        v->writev("vMix", c->vMix, meta::noise_generator::NUM_GENERATORS);
+                        v->write("fMixIn", c->fMixIn);
+                        v->writev("vSources", c->vSources, c->nSources);
+                        v->write("nSources", c->nSources);
+                        v->write("fLevelIn", c->fLevelIn);
+                        v->write("fLevelOut", c->fLevelOut);
                         v->write("bActive", c->bActive);
+                        v->write("nUpdate", c->nUpdate);
                         v->write("vInBuffer", c->vInBuffer);
                         v->write("vOutBuffer", c->vOutBuffer);
                         v->write("vIn", c->vIn);
                         v->write("vOut", c->vOut);
+                        v->write("vOutData", c->vOutData);
 
                         // Audio Ports
                         v->write("pIn", c->pIn);
@@ -1067,6 +3568,7 @@ namespace lsp
                         v->write("pGainOut", c->pGainOut);
                         v->write("pMeterIn", c->pMeterIn);
                         v->write("pMeterOut", c->pMeterOut);
+                        v->write("pLoad", c->pLoad);
                         v->write("pSpectrumIn", c->pSpectrumIn);
                         v->write("pSpectrumOut", c->pSpectrumOut);
                     }
@@ -1081,8 +3583,67 @@ namespace lsp
             v->write("vFreqChart", vFreqChart);
             v->write("fGainIn", fGainIn);
             v->write("fGainOut", fGainOut);
+            v->write("nBypassHold", nBypassHold);
+            v->write("nCacheSegment", nCacheSegment);
+            v->write("vFadeIn", vFadeIn);
+            v->write("vFadeOut", vFadeOut);
+            v->write("bBypass", bBypass);
+            v->write("bParallel", bParallel);
+            v->write("bSeeded", bSeeded);
+            v->write("bUIActive", bUIActive);
+            v->write("bDirect", bDirect);
             v->write("pData", pData);
+            v->write("pBlockData", pBlockData);
+            v->write("pAnData", pAnData);
+            v->write("nDataSize", nDataSize);
+            v->write("nBlockDataSize", nBlockDataSize);
+            v->write("nAnDataSize", nAnDataSize);
+            v->write("nBlockSize", nBlockSize);
+            v->write("nMaxBlock", nMaxBlock);
+            v->write("nBlockRequest", nBlockRequest);
+            v->write("pBlockGarbage", pBlockGarbage);
+            v->write("nTileSize", nTileSize);
+            v->write("bAnInit", bAnInit);
+            v->write("bMeasure", bMeasure);
+            v->write_object("sAnLoad", &sAnLoad);
+            v->write_object("sTotalLoad", &sTotalLoad);
+            v->write("nFootprint", memory_footprint());
             v->write_object("pIDisplay", pIDisplay);
+            v->write("vIDisplayIdx", vIDisplayIdx);
+            v->writev("vIDisplayGridX", vIDisplayGridX, nIDisplayGridX);
+            v->writev("vIDisplayGridY", vIDisplayGridY, nIDisplayGridY);
+            v->write("nIDisplayWidth", nIDisplayWidth);
+            v->write("nIDisplayHeight", nIDisplayHeight);
+            v->write("nIDisplayRate", nIDisplayRate);
+            v->begin_array("vChartFrames", vChartFrames, 3);
+            {
+                for (size_t i=0; i<3; ++i)
+                {
+                    const chart_frame_t *f  = &vChartFrames[i];
+                    v->begin_object(f, sizeof(chart_frame_t));
+                    {
+                        v->write("nVersion", f->nVersion);
+                        v->writev("vActive", f->vActive, meta::noise_generator::NUM_GENERATORS);
+                        v->begin_array("vData", f->vData, meta::noise_generator::NUM_GENERATORS);
+                        {
+                            for (size_t j=0; j<meta::noise_generator::NUM_GENERATORS; ++j)
+                                v->write(f->vData[j]);
+                        }
+                        v->end_array();
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+            v->write("nChartSwap", nChartSwap);
+            v->write("nChartBack", nChartBack);
+            v->write("nChartFront", nChartFront);
+            v->write("nChartVersion", nChartVersion);
+            v->write("nIDisplayVersion", nIDisplayVersion);
+            v->write("pIDisplayCanvas", pIDisplayCanvas);
+            v->write("bIDisplayBypass", bIDisplayBypass);
+            v->write("bIDisplayActive", bIDisplayActive);
+            v->write("bIDisplayValid", bIDisplayValid);
 
             // Dump global ports
             v->write("pBypass", pBypass);
@@ -1093,6 +3654,13 @@ namespace lsp
             v->write("pFftGen", pFftGen);
             v->write("pReactivity", pReactivity);
             v->write("pShiftGain", pShiftGain);
+            v->write("pFftThread", pFftThread);
+            v->write("pFftAnalytic", pFftAnalytic);
+            v->write("pParallel", pParallel);
+            v->write("pSeeded", pSeeded);
+            v->write("pSeed", pSeed);
+            v->write("pMeasure", pMeasure);
+            v->write("pLoad", pLoad);
         }
 
     } /* namespace plugins */
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#include <private/plugins/sample_ring.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        sample_ring::sample_ring()
+        {
+            construct();
+        }
+
+        sample_ring::~sample_ring()
+        {
+            destroy();
+        }
+
+        void sample_ring::construct()
+        {
+            nLanes          = 0;
+            nCapacity       = 0;
+            nHead           = 0;
+            nTail           = 0;
+            nDropped        = 0;
+            vLanes          = NULL;
+            pData           = NULL;
+        }
+
+        void sample_ring::destroy()
+        {
+            if (pData != NULL)
+            {
+                free_aligned(pData);
+                pData       = NULL;
+            }
+
+            vLanes          = NULL;
+            nLanes          = 0;
+            nCapacity       = 0;
+        }
+
+        bool sample_ring::init(size_t lanes, size_t capacity)
+        {
+            destroy();
+
+            size_t cap              = 1;
+            while (cap < capacity)
+                cap                   <<= 1;
+
+            const size_t ptr_sz     = align_size(lanes * sizeof(float *), DEFAULT_ALIGN);
+            const size_t lane_sz    = align_size(cap * sizeof(float), DEFAULT_ALIGN);
+            uint8_t *ptr            = alloc_aligned<uint8_t>(pData, ptr_sz + lane_sz * lanes, DEFAULT_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            vLanes                  = reinterpret_cast<float **>(ptr);
+            ptr                    += ptr_sz;
+            for (size_t i=0; i<lanes; ++i)
+            {
+                vLanes[i]               = reinterpret_cast<float *>(ptr);
+                ptr                    += lane_sz;
+            }
+
+            nLanes                  = lanes;
+            nCapacity               = cap;
+            clear();
+
+            return true;
+        }
+
+        void sample_ring::clear()
+        {
+            atomic_store(&nHead, uatomic_t(0));
+            atomic_store(&nTail, uatomic_t(0));
+            atomic_store(&nDropped, uatomic_t(0));
+        }
+
+        size_t sample_ring::pending() const
+        {
+            // The counters wrap around, the difference is still valid since it never exceeds the capacity
+            const uatomic_t head    = atomic_load(const_cast<uatomic_t *>(&nHead));
+            const uatomic_t tail    = atomic_load(const_cast<uatomic_t *>(&nTail));
+            return uatomic_t(head - tail);
+        }
+
+        size_t sample_ring::footprint() const
+        {
+            if (pData == NULL)
+                return 0;
+
+            return align_size(nLanes * sizeof(float *), DEFAULT_ALIGN) +
+                   align_size(nCapacity * sizeof(float), DEFAULT_ALIGN) * nLanes;
+        }
+
+        size_t sample_ring::push(const float * const *src, size_t count)
+        {
+            const uatomic_t head    = nHead;                    // Only the producer modifies the head
+            const uatomic_t tail    = atomic_load(&nTail);
+            const size_t to_do      = lsp_min(count, nCapacity - uatomic_t(head - tail));
+            if (to_do < count)
+                atomic_add(&nDropped, uatomic_t(count - to_do));
+            if (to_do <= 0)
+                return 0;
+
+            // Copy the data in two parts if it crosses the end of the ring
+            const size_t off        = head & (nCapacity - 1);
+            const size_t first      = lsp_min(to_do, nCapacity - off);
+            for (size_t i=0; i<nLanes; ++i)
+            {
+                dsp::copy(&vLanes[i][off], src[i], first);
+                if (first < to_do)
+                    dsp::copy(vLanes[i], &src[i][first], to_do - first);
+            }
+
+            // Publish the data after it has been written
+            atomic_store(&nHead, uatomic_t(head + to_do));
+            return to_do;
+        }
+
+        size_t sample_ring::pop(float * const *dst, size_t count)
+        {
+            const uatomic_t tail    = nTail;                    // Only the consumer modifies the tail
+            const uatomic_t head    = atomic_load(&nHead);
+            const size_t to_do      = lsp_min(count, size_t(uatomic_t(head - tail)));
+            if (to_do <= 0)
+                return 0;
+
+            const size_t off        = tail & (nCapacity - 1);
+            const size_t first      = lsp_min(to_do, nCapacity - off);
+            for (size_t i=0; i<nLanes; ++i)
+            {
+                dsp::copy(dst[i], &vLanes[i][off], first);
+                if (first < to_do)
+                    dsp::copy(&dst[i][first], vLanes[i], to_do - first);
+            }
+
+            // Release the space after the data has been read
+            atomic_store(&nTail, uatomic_t(tail + to_do));
+            return to_do;
+        }
+
+        void sample_ring::dump(dspu::IStateDumper *v) const
+        {
+            v->write("nLanes", nLanes);
+            v->write("nCapacity", nCapacity);
+            v->write("nHead", nHead);
+            v->write("nTail", nTail);
+            v->write("nDropped", nDropped);
+            v->write("vLanes", vLanes);
+            v->write("pData", pData);
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
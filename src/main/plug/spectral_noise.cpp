@@ -0,0 +1,300 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/units.h>
+
+#include <private/plugins/spectral_noise.h>
+
+#define SPECTRAL_FREQ_MIN           10.0f       // Frequency below which the magnitude is kept constant
+#define SPECTRAL_FREQ_REF           1000.0f     // Frequency with 0 dB gain of the magnitude
+
+namespace lsp
+{
+    namespace plugins
+    {
+        spectral_noise::spectral_noise()
+        {
+            construct();
+        }
+
+        spectral_noise::~spectral_noise()
+        {
+            destroy();
+        }
+
+        void spectral_noise::construct()
+        {
+            nSampleRate     = 0;
+            nRank           = 0;
+            nOffset         = 0;
+            fSlope          = 0.0f;
+            fAmplitude      = 1.0f;
+            fOffset         = 0.0f;
+            fFftNorm        = 1.0f;
+            fChartGain      = 1.0f;
+            bSpare          = false;
+            bUpdate         = true;
+
+            vMag            = NULL;
+            vWindow         = NULL;
+            vRe             = NULL;
+            vIm             = NULL;
+            vOverlap        = NULL;
+            vOut            = NULL;
+            pData           = NULL;
+        }
+
+        void spectral_noise::destroy()
+        {
+            if (pData != NULL)
+            {
+                free_aligned(pData);
+                pData       = NULL;
+            }
+
+            vMag            = NULL;
+            vWindow         = NULL;
+            vRe             = NULL;
+            vIm             = NULL;
+            vOverlap        = NULL;
+            vOut            = NULL;
+        }
+
+        bool spectral_noise::init(size_t rank, uint32_t seed)
+        {
+            destroy();
+
+            const size_t n          = 1 << rank;
+            const size_t h          = n >> 1;
+            const size_t frm_sz     = align_size(n * sizeof(float), DEFAULT_ALIGN);
+            const size_t half_sz    = align_size(h * sizeof(float), DEFAULT_ALIGN);
+            uint8_t *ptr            = alloc_aligned<uint8_t>(pData, frm_sz * 4 + half_sz * 2, DEFAULT_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            vMag                    = reinterpret_cast<float *>(ptr);
+            ptr                    += frm_sz;
+            vWindow                 = reinterpret_cast<float *>(ptr);
+            ptr                    += frm_sz;
+            vRe                     = reinterpret_cast<float *>(ptr);
+            ptr                    += frm_sz;
+            vIm                     = reinterpret_cast<float *>(ptr);
+            ptr                    += frm_sz;
+            vOverlap                = reinterpret_cast<float *>(ptr);
+            ptr                    += half_sz;
+            vOut                    = reinterpret_cast<float *>(ptr);
+            ptr                    += half_sz;
+
+            nRank                   = rank;
+            nOffset                 = h;
+            bSpare                  = false;
+            bUpdate                 = true;
+
+            // Sine window: squares of overlapping halves sum to 1, so the power of
+            // uncorrelated frames is kept constant after overlap-add
+            for (size_t i=0; i<n; ++i)
+                vWindow[i]              = sinf(M_PI * (i + 0.5f) / n);
+
+            // Estimate the normalization applied by the inverse FFT
+            dsp::fill_zero(vRe, n);
+            dsp::fill_zero(vIm, n);
+            vRe[0]                  = 1.0f;
+            dsp::reverse_fft(vRe, vIm, vRe, vIm, nRank);
+            fFftNorm                = vRe[0];
+
+            dsp::fill_zero(vOverlap, h);
+            sRand.init(seed);
+
+            return true;
+        }
+
+        void spectral_noise::reseed(uint32_t seed)
+        {
+            if (pData == NULL)
+                return;
+
+            const size_t h          = 1 << (nRank - 1);
+            nOffset                 = h;
+            bSpare                  = false;
+            dsp::fill_zero(vOverlap, h);
+            sRand.init(seed);
+        }
+
+        void spectral_noise::set_sample_rate(size_t sr)
+        {
+            if (nSampleRate == sr)
+                return;
+            nSampleRate     = sr;
+            bUpdate         = true;
+        }
+
+        void spectral_noise::set_slope(float slope, dspu::stlt_slope_unit_t unit)
+        {
+            // Convert slope to Neper-per-Neper
+            switch (unit)
+            {
+                case dspu::STLT_SLOPE_UNIT_DB_PER_OCTAVE:
+                    slope          /= 20.0f * log10f(2.0f);
+                    break;
+                case dspu::STLT_SLOPE_UNIT_DB_PER_DECADE:
+                    slope          /= 20.0f;
+                    break;
+                case dspu::STLT_SLOPE_UNIT_NEPER_PER_NEPER:
+                default:
+                    break;
+            }
+
+            if (fSlope == slope)
+                return;
+            fSlope          = slope;
+            bUpdate         = true;
+        }
+
+        void spectral_noise::set_amplitude(float amplitude)
+        {
+            if (fAmplitude == amplitude)
+                return;
+            fAmplitude      = amplitude;
+            bUpdate         = true;
+        }
+
+        void spectral_noise::set_offset(float offset)
+        {
+            fOffset         = offset;
+        }
+
+        void spectral_noise::update_magnitude()
+        {
+            const size_t n      = frame_size();
+            const size_t h      = n >> 1;
+            const float kf      = float(nSampleRate) / float(n);
+
+            // Compute the magnitude of the positive frequencies and mirror it to the negative ones
+            vMag[0]             = 0.0f;
+            for (size_t k=1; k<=h; ++k)
+                vMag[k]             = powf(lsp_max(k * kf, SPECTRAL_FREQ_MIN) / SPECTRAL_FREQ_REF, fSlope);
+            for (size_t k=1; k<h; ++k)
+                vMag[n - k]         = vMag[k];
+
+            // Normalize the power of the noise to the power of uniform white noise with the same amplitude
+            const float power   = dsp::h_sqr_sum(vMag, n);
+            const float sigma   = fAmplitude / sqrtf(3.0f);
+            const float norm    = (power > 0.0f) ? sigma / (fFftNorm * sqrtf(power)) : 0.0f;
+            dsp::mul_k2(vMag, norm, n);
+            fChartGain          = (power > 0.0f) ? sqrtf(float(n) / power) : 0.0f;
+
+            bUpdate             = false;
+        }
+
+        void spectral_noise::synthesize_frame()
+        {
+            const size_t n      = frame_size();
+
+            // Make complex gaussian spectrum by applying the Box-Muller transform. Since
+            // the spectrum is not hermitian, both the real and imaginary part of the inverse FFT
+            // are independent noise frames with the desired power spectrum.
+            for (size_t k=0; k<n; ++k)
+            {
+                const float r       = sqrtf(-2.0f * logf(1.0f - sRand.random(dspu::RND_LINEAR))) * vMag[k];
+                const float a       = 2.0f * M_PI * sRand.random(dspu::RND_LINEAR);
+                vRe[k]              = r * cosf(a);
+                vIm[k]              = r * sinf(a);
+            }
+
+            dsp::reverse_fft(vRe, vIm, vRe, vIm, nRank);
+            dsp::mul2(vRe, vWindow, n);
+            dsp::mul2(vIm, vWindow, n);
+        }
+
+        void spectral_noise::synthesize_block()
+        {
+            const size_t h      = frame_size() >> 1;
+            const float *frame  = vIm;
+
+            if (bSpare)
+                bSpare              = false;
+            else
+            {
+                if (bUpdate)
+                    update_magnitude();
+                synthesize_frame();
+                frame               = vRe;
+                bSpare              = true;
+            }
+
+            // Overlap-add
+            dsp::add3(vOut, vOverlap, frame, h);
+            dsp::copy(vOverlap, &frame[h], h);
+            nOffset             = 0;
+        }
+
+        void spectral_noise::process_overwrite(float *dst, size_t count)
+        {
+            const size_t h      = frame_size() >> 1;
+
+            for (size_t offset=0; offset < count; )
+            {
+                if (nOffset >= h)
+                    synthesize_block();
+
+                size_t to_do        = lsp_min(count - offset, h - nOffset);
+                dsp::copy(&dst[offset], &vOut[nOffset], to_do);
+                nOffset            += to_do;
+                offset             += to_do;
+            }
+
+            if (fOffset != 0.0f)
+                dsp::add_k2(dst, fOffset, count);
+        }
+
+        void spectral_noise::freq_chart(float *dst, const float *f, size_t count) const
+        {
+            for (size_t i=0; i<count; ++i)
+                dst[i]              = powf(lsp_max(f[i], SPECTRAL_FREQ_MIN) / SPECTRAL_FREQ_REF, fSlope);
+        }
+
+        void spectral_noise::dump(dspu::IStateDumper *v) const
+        {
+            v->write_object("sRand", &sRand);
+            v->write("nSampleRate", nSampleRate);
+            v->write("nRank", nRank);
+            v->write("nOffset", nOffset);
+            v->write("fSlope", fSlope);
+            v->write("fAmplitude", fAmplitude);
+            v->write("fOffset", fOffset);
+            v->write("fFftNorm", fFftNorm);
+            v->write("fChartGain", fChartGain);
+            v->write("bSpare", bSpare);
+            v->write("bUpdate", bUpdate);
+
+            v->write("vMag", vMag);
+            v->write("vWindow", vWindow);
+            v->write("vRe", vRe);
+            v->write("vIm", vIm);
+            v->write("vOverlap", vOverlap);
+            v->write("vOut", vOut);
+            v->write("pData", pData);
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
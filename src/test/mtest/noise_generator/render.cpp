@@ -0,0 +1,358 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+
+#if defined(PLATFORM_LINUX) || defined(PLATFORM_BSD)
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/ipc/NativeExecutor.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+#include <lsp-plug.in/test-fw/mtest.h>
+
+#include <private/meta/noise_generator.h>
+#include <private/plugins/noise_generator.h>
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sndfile.h>
+
+#define RENDER_BLOCK_SIZE       0x10000     // Number of frames processed per one call
+#define RENDER_SAMPLE_RATE      48000       // Default sample rate
+#define RENDER_LINE_SIZE        1024        // Maximum length of the configuration line
+
+namespace
+{
+    using namespace lsp;
+
+    /**
+     * Port of the offline host: control ports keep their value, audio ports
+     * refer to the block buffer, all other ports are not connected
+     */
+    class Port: public plug::IPort
+    {
+        protected:
+            float       fValue;
+            float      *pBuffer;
+
+        public:
+            explicit Port(const meta::port_t *meta): plug::IPort(meta)
+            {
+                fValue      = meta->start;
+                pBuffer     = NULL;
+            }
+
+        public:
+            virtual float value() override              { return fValue; }
+            virtual void set_value(float value) override { fValue = value; }
+            virtual void *buffer() override             { return pBuffer; }
+
+            void bind(float *buf)                       { pBuffer = buf; }
+    };
+
+    /**
+     * Wrapper of the offline host: provides the executor only
+     */
+    class Wrapper: public plug::IWrapper
+    {
+        protected:
+            ipc::IExecutor     *pExecutor;
+
+        public:
+            explicit Wrapper(plug::Module *plugin, ipc::IExecutor *executor): plug::IWrapper(plugin, NULL)
+            {
+                pExecutor   = executor;
+            }
+
+            virtual ipc::IExecutor *executor() override { return pExecutor; }
+    };
+
+    typedef struct variant_t
+    {
+        const char             *id;
+        const meta::plugin_t   *meta;
+        size_t                  channels;
+    } variant_t;
+
+    static const variant_t variants[] =
+    {
+        { "noise_generator_x1", &meta::noise_generator_x1, 1 },
+        { "noise_generator_x2", &meta::noise_generator_x2, 2 },
+        { "noise_generator_x4", &meta::noise_generator_x4, 4 },
+        { NULL, NULL, 0 }
+    };
+
+    static const variant_t *find_variant(const char *id)
+    {
+        for (const variant_t *v = variants; v->id != NULL; ++v)
+            if (!strcmp(v->id, id))
+                return v;
+        return NULL;
+    }
+
+    static plug::IPort *find_port(plug::IPort **ports, size_t count, const char *id)
+    {
+        for (size_t i=0; i<count; ++i)
+            if (!strcmp(ports[i]->metadata()->id, id))
+                return ports[i];
+        return NULL;
+    }
+
+    static char *trim(char *s)
+    {
+        while (isspace(*s))
+            ++s;
+        char *e = &s[strlen(s)];
+        while ((e > s) && (isspace(e[-1])))
+            --e;
+        *e = '\0';
+        return s;
+    }
+
+    static bool parse_value(const char *s, float *value)
+    {
+        if (!strcasecmp(s, "true"))
+        {
+            *value  = 1.0f;
+            return true;
+        }
+        if (!strcasecmp(s, "false"))
+        {
+            *value  = 0.0f;
+            return true;
+        }
+
+        char *end   = NULL;
+        errno       = 0;
+        float v     = strtof(s, &end);
+        if ((errno != 0) || (end == s))
+            return false;
+        while (isspace(*end))
+            ++end;
+
+        if (!strcasecmp(end, "db"))
+            v       = dspu::db_to_gain(v);
+        else if (*end != '\0')
+            return false;
+
+        *value      = v;
+        return true;
+    }
+
+    /**
+     * Load the configuration file in the format exported by the plugin: 'key = value' lines,
+     * comments start with '#', gains may be specified in decibels with the 'db' suffix
+     */
+    static bool load_config(const char *path, plug::IPort **ports, size_t count)
+    {
+        FILE *fd = fopen(path, "r");
+        if (fd == NULL)
+            return false;
+
+        char line[RENDER_LINE_SIZE];
+        size_t num = 0;
+        bool res = true;
+
+        while (fgets(line, sizeof(line), fd) != NULL)
+        {
+            ++num;
+            char *key = trim(line);
+            if ((*key == '\0') || (*key == '#'))
+                continue;
+
+            char *split = strchr(key, '=');
+            if (split == NULL)
+            {
+                fprintf(stderr, "%s:%d: missing '=' character\n", path, int(num));
+                res = false;
+                break;
+            }
+            *split = '\0';
+            key = trim(key);
+            const char *text = trim(&split[1]);
+
+            plug::IPort *p = find_port(ports, count, key);
+            if (p == NULL)
+            {
+                fprintf(stderr, "%s:%d: unknown port '%s', skipping\n", path, int(num), key);
+                continue;
+            }
+
+            float value = 0.0f;
+            if (!parse_value(text, &value))
+            {
+                fprintf(stderr, "%s:%d: invalid value '%s' for port '%s'\n", path, int(num), text, key);
+                res = false;
+                break;
+            }
+            p->set_value(value);
+        }
+
+        fclose(fd);
+        return res;
+    }
+
+    static int output_format(const char *path)
+    {
+        const char *ext = strrchr(path, '.');
+        if ((ext != NULL) && (!strcasecmp(ext, ".flac")))
+            return SF_FORMAT_FLAC | SF_FORMAT_PCM_24;
+        return SF_FORMAT_WAV | SF_FORMAT_FLOAT;
+    }
+}
+
+MTEST_BEGIN("noise_generator", render)
+
+    MTEST_MAIN
+    {
+        if (argc < 4)
+        {
+            printf("Usage: %s <plugin id> <config.cfg> <output.wav|output.flac> <seconds> [sample rate]\n", full_name());
+            printf("  plugin id is one of: noise_generator_x1, noise_generator_x2, noise_generator_x4\n");
+            printf("  Rendering uses at most one thread per generator and per channel of the plugin: the first\n");
+            printf("  blocks are rendered by one thread until the worker threads are started. Time segments\n");
+            printf("  are not rendered in parallel: restoring the stream at the start of the segment replays\n");
+            printf("  it from the beginning for all generators except white counter-based noise.\n");
+            return;
+        }
+
+        const variant_t *variant    = find_variant(argv[0]);
+        MTEST_ASSERT_MSG(variant != NULL, "Unknown plugin identifier: %s", argv[0]);
+
+        const double seconds        = atof(argv[3]);
+        const long srate            = (argc > 4) ? atol(argv[4]) : RENDER_SAMPLE_RATE;
+        MTEST_ASSERT_MSG(seconds > 0.0, "Invalid duration: %s", argv[3]);
+        MTEST_ASSERT_MSG(srate > 0, "Invalid sample rate: %s", argv[4]);
+
+        const size_t channels       = variant->channels;
+        const size_t frames         = size_t(seconds * srate);
+
+        // Create ports
+        size_t num_ports = 0;
+        for (const meta::port_t *p = variant->meta->ports; p->id != NULL; ++p)
+            ++num_ports;
+
+        plug::IPort **ports         = static_cast<plug::IPort **>(malloc(num_ports * sizeof(plug::IPort *)));
+        MTEST_ASSERT(ports != NULL);
+        for (size_t i=0; i<num_ports; ++i)
+            ports[i]                    = new Port(&variant->meta->ports[i]);
+
+        // Allocate block buffers: one zero-filled input and one output per channel,
+        // and the interleaved buffer for the file
+        uint8_t *data               = NULL;
+        float *buf                  = alloc_aligned<float>(data, RENDER_BLOCK_SIZE * channels * 3, DEFAULT_ALIGN);
+        MTEST_ASSERT(buf != NULL);
+        float *in                   = buf;
+        float *out                  = &in[RENDER_BLOCK_SIZE * channels];
+        float *frame                = &out[RENDER_BLOCK_SIZE * channels];
+        dsp::fill_zero(in, RENDER_BLOCK_SIZE * channels);
+
+        size_t in_id = 0, out_id = 0;
+        for (size_t i=0; i<num_ports; ++i)
+        {
+            const meta::port_t *meta    = ports[i]->metadata();
+            Port *p                     = static_cast<Port *>(ports[i]);
+            if (meta::is_audio_in_port(meta))
+                p->bind(&in[RENDER_BLOCK_SIZE * (in_id++)]);
+            else if (meta::is_audio_out_port(meta))
+                p->bind(&out[RENDER_BLOCK_SIZE * (out_id++)]);
+        }
+        MTEST_ASSERT((in_id == channels) && (out_id == channels));
+
+        // Load configuration. Spectrum analysis is useless without UI, rendering
+        // of generators and channels is distributed among the worker threads.
+        MTEST_ASSERT_MSG(load_config(argv[1], ports, num_ports), "Could not load configuration file: %s", argv[1]);
+        for (size_t i=0; i<num_ports; ++i)
+        {
+            if (!strncmp(ports[i]->metadata()->id, "fft", 3))
+                ports[i]->set_value(0.0f);
+        }
+        plug::IPort *par            = find_port(ports, num_ports, "par");
+        if (par != NULL)
+            par->set_value(1.0f);
+
+        // Open the output file
+        SF_INFO info;
+        memset(&info, 0, sizeof(info));
+        info.samplerate             = srate;
+        info.channels               = channels;
+        info.format                 = output_format(argv[2]);
+        MTEST_ASSERT_MSG(sf_format_check(&info), "Unsupported output format: %s", argv[2]);
+        SNDFILE *sf                 = sf_open(argv[2], SFM_WRITE, &info);
+        MTEST_ASSERT_MSG(sf != NULL, "Could not create output file %s: %s", argv[2], sf_strerror(NULL));
+
+        // Create and initialize the plugin
+        ipc::NativeExecutor executor;
+        MTEST_ASSERT(executor.start() == STATUS_OK);
+
+        plugins::noise_generator *plugin = new plugins::noise_generator(variant->meta);
+        Wrapper wrapper(plugin, &executor);
+
+        plugin->init(&wrapper, ports);
+        plugin->set_sample_rate(srate);
+        plugin->activate();
+        plugin->update_settings();
+
+        // Render the file
+        printf("Rendering %d frames of %d channels at %d Hz to %s\n", int(frames), int(channels), int(srate), argv[2]);
+        for (size_t offset = 0; offset < frames; )
+        {
+            const size_t to_do  = lsp_min(frames - offset, size_t(RENDER_BLOCK_SIZE));
+            plugin->process(to_do);
+
+            for (size_t i=0; i<channels; ++i)
+            {
+                const float *src    = &out[RENDER_BLOCK_SIZE * i];
+                float *dst          = &frame[i];
+                for (size_t j=0; j<to_do; ++j, dst += channels)
+                    *dst                = src[j];
+            }
+
+            if (sf_writef_float(sf, frame, to_do) != sf_count_t(to_do))
+            {
+                fprintf(stderr, "Error writing file %s: %s\n", argv[2], sf_strerror(sf));
+                break;
+            }
+            offset             += to_do;
+        }
+
+        // Destroy everything
+        plugin->deactivate();
+        plugin->destroy();
+        delete plugin;
+        executor.shutdown();
+        sf_close(sf);
+
+        for (size_t i=0; i<num_ports; ++i)
+            delete ports[i];
+        free(ports);
+        free_aligned(data);
+    }
+
+MTEST_END
+
+#endif /* PLATFORM_LINUX || PLATFORM_BSD */
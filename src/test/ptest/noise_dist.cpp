@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/noise/LCG.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/plugins/noise_dist.h>
+
+#include <math.h>
+
+#define MIN_RANK    8
+#define MAX_RANK    16
+
+namespace
+{
+    using namespace lsp;
+
+    typedef void (* dist_func_t)(float *dst, const uint32_t *src, size_t count);
+
+    // Per-sample transforms with calls of the math library, used as the reference
+    static void ref_exponential(float *dst, const uint32_t *src, size_t count)
+    {
+        const float k   = 1.0f / sqrtf(6.0f);
+        for (size_t i=0; i<count; ++i)
+        {
+            const float u   = (float(src[i] >> 8) + 0.5f) * (1.0f / 16777216.0f);
+            const float v   = -logf(u) * k;
+            dst[i]          = (src[i] & 1) ? -v : v;
+        }
+    }
+
+    static void ref_gaussian(float *dst, const uint32_t *src, size_t count)
+    {
+        const float sigma   = 1.0f / sqrtf(3.0f);
+        for (size_t i=0; i<count; i += 2)
+        {
+            const float u1  = (float(src[i] >> 8) + 0.5f) * (1.0f / 16777216.0f);
+            const float u2  = float(src[i+1] >> 8) * (1.0f / 16777216.0f);
+            const float r   = sqrtf(-2.0f * logf(u1)) * sigma;
+            const float a   = 2.0f * M_PI * u2;
+            dst[i]          = r * cosf(a);
+            dst[i+1]        = r * sinf(a);
+        }
+    }
+}
+
+PTEST_BEGIN("noise_generator", noise_dist, 5, 1000)
+
+    void call(const char *label, float *dst, const uint32_t *src, size_t count, dist_func_t func)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, src, count);
+        );
+    }
+
+    void call_lcg(const char *label, dspu::LCG *lcg, dspu::lcg_dist_t dist, float *dst, size_t count)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        lcg->set_distribution(dist);
+        PTEST_LOOP(buf,
+            lcg->process_overwrite(dst, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        const size_t buf_size   = 1 << MAX_RANK;
+        uint8_t *data           = NULL;
+        float *dst              = alloc_aligned<float>(data, buf_size * 2, 64);
+        uint32_t *src           = reinterpret_cast<uint32_t *>(&dst[buf_size]);
+
+        uint32_t x              = 0x12345678;
+        for (size_t i=0; i<buf_size; ++i)
+        {
+            x                      ^= x << 13;
+            x                      ^= x >> 17;
+            x                      ^= x << 5;
+            src[i]                  = x;
+        }
+
+        dspu::LCG lcg;
+        lcg.construct();
+        lcg.init(0x12345678);
+        lcg.set_amplitude(1.0f);
+        lcg.set_offset(0.0f);
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            const size_t count = 1 << i;
+
+            call("uniform", dst, src, count, plugins::noise_dist::uniform);
+            call("triangular", dst, src, count, plugins::noise_dist::triangular);
+            call("exponential", dst, src, count, plugins::noise_dist::exponential);
+            call("exponential_ref", dst, src, count, ref_exponential);
+            call("gaussian", dst, src, count, plugins::noise_dist::gaussian);
+            call("gaussian_ref", dst, src, count, ref_gaussian);
+            PTEST_SEPARATOR;
+
+            call_lcg("lcg_uniform", &lcg, dspu::LCG_UNIFORM, dst, count);
+            call_lcg("lcg_triangular", &lcg, dspu::LCG_TRIANGULAR, dst, count);
+            call_lcg("lcg_exponential", &lcg, dspu::LCG_EXPONENTIAL, dst, count);
+            call_lcg("lcg_gaussian", &lcg, dspu::LCG_GAUSSIAN, dst, count);
+            PTEST_SEPARATOR2;
+        }
+
+        lcg.destroy();
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,464 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 15 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/ipc/NativeExecutor.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+#include <lsp-plug.in/runtime/system.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/meta/noise_generator.h>
+#include <private/plugins/noise_generator.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_WARMUP            0.05        // Duration of processing before each measurement [s]
+#define BENCH_SAMPLE_RATE       48000       // Default sample rate
+#define BENCH_BLOCK_SIZE        1024        // Default block size
+#define BENCH_TILE_SIZE         0x100       // Default tile size of the plugin
+#define BENCH_MIN_BLOCK         16          // Minimum block size
+#define BENCH_MAX_BLOCK         8192        // Maximum block size
+
+namespace
+{
+    using namespace lsp;
+
+    /**
+     * Port of the benchmark host: control ports keep their value, audio ports
+     * refer to the block buffer, all other ports are not connected
+     */
+    class Port: public plug::IPort
+    {
+        protected:
+            float       fValue;
+            float      *pBuffer;
+
+        public:
+            explicit Port(const meta::port_t *meta): plug::IPort(meta)
+            {
+                fValue      = meta->start;
+                pBuffer     = NULL;
+            }
+
+        public:
+            virtual float value() override              { return fValue; }
+            virtual void set_value(float value) override { fValue = value; }
+            virtual void *buffer() override             { return pBuffer; }
+
+            void bind(float *buf)                       { pBuffer = buf; }
+    };
+
+    /**
+     * Wrapper of the benchmark host: provides the executor only
+     */
+    class Wrapper: public plug::IWrapper
+    {
+        protected:
+            ipc::IExecutor     *pExecutor;
+
+        public:
+            explicit Wrapper(plug::Module *plugin, ipc::IExecutor *executor): plug::IWrapper(plugin, NULL)
+            {
+                pExecutor   = executor;
+            }
+
+            virtual ipc::IExecutor *executor() override { return pExecutor; }
+    };
+
+    typedef struct variant_t
+    {
+        const char             *id;
+        const meta::plugin_t   *meta;
+        size_t                  channels;
+    } variant_t;
+
+    static const variant_t variants[] =
+    {
+        { "x1", &meta::noise_generator_x1, 1 },
+        { "x2", &meta::noise_generator_x2, 2 },
+        { "x4", &meta::noise_generator_x4, 4 },
+        { NULL, NULL, 0 }
+    };
+
+    typedef struct item_t
+    {
+        const char             *id;
+        size_t                  value;
+    } item_t;
+
+    static const item_t lcg_dists[] =
+    {
+        { "uniform",        meta::noise_generator_metadata::NOISE_LCG_UNIFORM },
+        { "exponential",    meta::noise_generator_metadata::NOISE_LCG_EXPONENTIAL },
+        { "triangular",     meta::noise_generator_metadata::NOISE_LCG_TRIANGULAR },
+        { "gaussian",       meta::noise_generator_metadata::NOISE_LCG_GAUSSIAN },
+        { NULL,             0 }
+    };
+
+    static const item_t velvet_types[] =
+    {
+        { "ovn",            meta::noise_generator_metadata::NOISE_VELVET_OVN },
+        { "ovna",           meta::noise_generator_metadata::NOISE_VELVET_OVNA },
+        { "arn",            meta::noise_generator_metadata::NOISE_VELVET_ARN },
+        { "trn",            meta::noise_generator_metadata::NOISE_VELVET_TRN },
+        { NULL,             0 }
+    };
+
+    static const item_t colors[] =
+    {
+        { "white",          meta::noise_generator_metadata::NOISE_COLOR_WHITE },
+        { "pink",           meta::noise_generator_metadata::NOISE_COLOR_PINK },
+        { "red",            meta::noise_generator_metadata::NOISE_COLOR_RED },
+        { "blue",           meta::noise_generator_metadata::NOISE_COLOR_BLUE },
+        { "violet",         meta::noise_generator_metadata::NOISE_COLOR_VIOLET },
+        { "npn",            meta::noise_generator_metadata::NOISE_COLOR_ARBITRARY_NPN },
+        { "dbo",            meta::noise_generator_metadata::NOISE_COLOR_ARBITRARY_DBO },
+        { "dbd",            meta::noise_generator_metadata::NOISE_COLOR_ARBITRARY_DBD },
+        { NULL,             0 }
+    };
+
+    static const item_t ina_filters[] =
+    {
+        { "butterworth",    meta::noise_generator_metadata::NOISE_INA_BUTTERWORTH },
+        { "chebyshev",      meta::noise_generator_metadata::NOISE_INA_CHEBYSHEV },
+        { NULL,             0 }
+    };
+
+    static const size_t sample_rates[] =
+    {
+        44100, 48000, 88200, 96000, 176400, 192000, 0
+    };
+
+    /**
+     * Plugin instance with the synthetic ports and the block buffers
+     */
+    typedef struct bench_t
+    {
+        const variant_t            *variant;
+        plugins::noise_generator   *plugin;
+        Wrapper                    *wrapper;
+        plug::IPort               **ports;
+        size_t                      num_ports;
+        size_t                      srate;
+        float                      *buf;
+        uint8_t                    *data;
+    } bench_t;
+
+    static plug::IPort *find_port(bench_t *b, const char *id)
+    {
+        for (size_t i=0; i<b->num_ports; ++i)
+            if (!strcmp(b->ports[i]->metadata()->id, id))
+                return b->ports[i];
+        return NULL;
+    }
+
+    static void set_port(bench_t *b, const char *id, float value)
+    {
+        plug::IPort *p = find_port(b, id);
+        if (p != NULL)
+            p->set_value(value);
+    }
+
+    static const char *type_name(size_t type)
+    {
+        switch (type)
+        {
+            case meta::noise_generator_metadata::NOISE_TYPE_MLS:        return "mls";
+            case meta::noise_generator_metadata::NOISE_TYPE_LCG:        return "lcg";
+            case meta::noise_generator_metadata::NOISE_TYPE_VELVET:     return "velvet";
+            case meta::noise_generator_metadata::NOISE_TYPE_SPECTRAL:   return "spectral";
+            case meta::noise_generator_metadata::NOISE_TYPE_COUNTER:    return "counter";
+            default: break;
+        }
+        return "off";
+    }
+
+    static double time_diff(const system::time_t *start, const system::time_t *end)
+    {
+        return double(end->seconds - start->seconds) + double(end->nanos - start->nanos) * 1e-9;
+    }
+}
+
+PTEST_BEGIN("noise_generator", process, 5, 1000)
+
+    FILE   *pOut;
+
+    bool create(bench_t *b, const variant_t *variant, ipc::IExecutor *executor)
+    {
+        b->variant      = variant;
+        b->plugin       = NULL;
+        b->wrapper      = NULL;
+        b->ports        = NULL;
+        b->num_ports    = 0;
+        b->srate        = BENCH_SAMPLE_RATE;
+        b->buf          = NULL;
+        b->data         = NULL;
+
+        // Create ports
+        for (const meta::port_t *p = variant->meta->ports; p->id != NULL; ++p)
+            ++b->num_ports;
+        b->ports        = static_cast<plug::IPort **>(malloc(b->num_ports * sizeof(plug::IPort *)));
+        if (b->ports == NULL)
+            return false;
+        for (size_t i=0; i<b->num_ports; ++i)
+            b->ports[i]     = new Port(&variant->meta->ports[i]);
+
+        // Bind zero-filled input and output buffers of each channel
+        const size_t channels   = variant->channels;
+        b->buf          = alloc_aligned<float>(b->data, BENCH_MAX_BLOCK * channels * 2, DEFAULT_ALIGN);
+        if (b->buf == NULL)
+            return false;
+        dsp::fill_zero(b->buf, BENCH_MAX_BLOCK * channels * 2);
+
+        size_t in_id = 0, out_id = 0;
+        for (size_t i=0; i<b->num_ports; ++i)
+        {
+            const meta::port_t *meta    = b->ports[i]->metadata();
+            Port *p                     = static_cast<Port *>(b->ports[i]);
+            if (meta::is_audio_in_port(meta))
+                p->bind(&b->buf[BENCH_MAX_BLOCK * (in_id++)]);
+            else if (meta::is_audio_out_port(meta))
+                p->bind(&b->buf[BENCH_MAX_BLOCK * (channels + out_id++)]);
+        }
+
+        // The spectrum analysis runs only when the UI is visible, so measure the audio path only
+        for (size_t i=0; i<b->num_ports; ++i)
+        {
+            if (!strncmp(b->ports[i]->metadata()->id, "fft", 3))
+                b->ports[i]->set_value(0.0f);
+        }
+
+        // Create and initialize the plugin
+        b->plugin       = new plugins::noise_generator(variant->meta);
+        b->wrapper      = new Wrapper(b->plugin, executor);
+        b->plugin->init(b->wrapper, b->ports);
+        b->plugin->set_sample_rate(b->srate);
+        b->plugin->activate();
+        b->plugin->update_settings();
+
+        return true;
+    }
+
+    void destroy(bench_t *b)
+    {
+        if (b->plugin != NULL)
+        {
+            b->plugin->deactivate();
+            b->plugin->destroy();
+            delete b->plugin;
+            b->plugin       = NULL;
+        }
+        if (b->wrapper != NULL)
+        {
+            delete b->wrapper;
+            b->wrapper      = NULL;
+        }
+        if (b->ports != NULL)
+        {
+            for (size_t i=0; i<b->num_ports; ++i)
+                delete b->ports[i];
+            free(b->ports);
+            b->ports        = NULL;
+        }
+        if (b->data != NULL)
+        {
+            free_aligned(b->data);
+            b->data         = NULL;
+            b->buf          = NULL;
+        }
+    }
+
+    /**
+     * Configure the first generator
+     * @param ina inaudible filter, NULL for audible noise
+     */
+    void configure(bench_t *b, size_t type, size_t dist, size_t velvet, size_t color, const item_t *ina)
+    {
+        set_port(b, "nt_1", type);
+        set_port(b, "ld_1", lcg_dists[dist].value);
+        set_port(b, "vt_1", velvet_types[velvet].value);
+        set_port(b, "cs_1", colors[color].value);
+        set_port(b, "ni_1", (ina != NULL) ? 1.0f : 0.0f);
+        if (ina != NULL)
+            set_port(b, "nif_1", ina->value);
+        b->plugin->update_settings();
+    }
+
+    /**
+     * Measure the processing and output the row of results: the key of the test ends with
+     * the number of samples processed per iteration. The CSV row reports the wall-clock time
+     * per sample frame, the frame contains one sample for each channel
+     */
+    void measure(bench_t *b, const char *section, const char *config, size_t block, size_t tile)
+    {
+        plugins::noise_generator *plugin = b->plugin;
+        plugin->set_tile_size(tile);
+
+        // Warm up the caches and settle the state of generators
+        for (size_t n = 0; n < size_t(BENCH_WARMUP * b->srate); n += block)
+            plugin->process(block);
+
+        char buf[160];
+        snprintf(buf, sizeof(buf), "%s %s %s sr=%d tile=%d x %d",
+            section, b->variant->id, config, int(b->srate), int(tile), int(block));
+        printf("Testing %s...\n", buf);
+
+        system::time_t start, end;
+        size_t iterations      = 0;
+        system::get_time(&start);
+        PTEST_LOOP(buf,
+            plugin->process(block);
+            ++iterations;
+        );
+        system::get_time(&end);
+
+        const double elapsed        = time_diff(&start, &end);
+        const double frames         = double(iterations) * block;
+        if ((pOut == NULL) || (frames <= 0.0) || (elapsed <= 0.0))
+            return;
+        fprintf(pOut, "%s,%s,%s,%d,%d,%d,%.3f,%.0f\n",
+            section, b->variant->id, config, int(b->srate), int(block), int(tile),
+            elapsed * 1e+9 / frames, frames / elapsed);
+        fflush(pOut);
+    }
+
+    // Every noise type and its variants with each colour and inaudible filter, single generator
+    void bench_generators(ipc::IExecutor *executor)
+    {
+        bench_t b;
+        if (create(&b, &variants[0], executor))
+        {
+            char config[80];
+            for (size_t type = meta::noise_generator_metadata::NOISE_TYPE_MLS;
+                 type <= meta::noise_generator_metadata::NOISE_TYPE_COUNTER; ++type)
+            {
+                const bool lcg          =
+                    (type == meta::noise_generator_metadata::NOISE_TYPE_LCG) ||
+                    (type == meta::noise_generator_metadata::NOISE_TYPE_COUNTER);
+                const bool velvet       = type == meta::noise_generator_metadata::NOISE_TYPE_VELVET;
+                const size_t count      = (lcg || velvet) ? 4 : 1;
+
+                for (size_t var = 0; var < count; ++var)
+                    for (size_t color = 0; colors[color].id != NULL; ++color)
+                        for (size_t ina = 0; (ina == 0) || (ina_filters[ina - 1].id != NULL); ++ina)
+                        {
+                            // The first pass is audible noise, then each inaudible filter
+                            const item_t *filter    = (ina > 0) ? &ina_filters[ina - 1] : NULL;
+                            const size_t dist       = (lcg) ? var : 0;
+                            const size_t vel        = (velvet) ? var : 0;
+                            snprintf(config, sizeof(config), "%s/%s/%s/%s",
+                                type_name(type),
+                                (lcg) ? lcg_dists[dist].id : (velvet) ? velvet_types[vel].id : "-",
+                                colors[color].id, (filter != NULL) ? filter->id : "audible");
+
+                            configure(&b, type, dist, vel, color, filter);
+                            measure(&b, "generator", config, BENCH_BLOCK_SIZE, BENCH_TILE_SIZE);
+                        }
+            }
+        }
+        destroy(&b);
+    }
+
+    // Default configuration of each variant at each sample rate
+    void bench_sample_rates(ipc::IExecutor *executor)
+    {
+        for (const variant_t *v = variants; v->id != NULL; ++v)
+        {
+            bench_t b;
+            if (create(&b, v, executor))
+            {
+                for (const size_t *sr = sample_rates; *sr != 0; ++sr)
+                {
+                    b.srate         = *sr;
+                    b.plugin->set_sample_rate(b.srate);
+                    for (size_t ina = 0; ina < 2; ++ina)
+                    {
+                        for (size_t i=1; i<=meta::noise_generator::NUM_GENERATORS; ++i)
+                        {
+                            char id[16];
+                            snprintf(id, sizeof(id), "ni_%d", int(i));
+                            set_port(&b, id, ina);
+                        }
+                        b.plugin->update_settings();
+                        measure(&b, "sample_rate", (ina > 0) ? "default/inaudible" : "default", BENCH_BLOCK_SIZE, BENCH_TILE_SIZE);
+                    }
+                }
+            }
+            destroy(&b);
+        }
+    }
+
+    // Default configuration of each variant with each block size, with and without tiling
+    void bench_block_sizes(ipc::IExecutor *executor)
+    {
+        for (const variant_t *v = variants; v->id != NULL; ++v)
+        {
+            bench_t b;
+            if (create(&b, v, executor))
+            {
+                for (size_t block = BENCH_MIN_BLOCK; block <= BENCH_MAX_BLOCK; block <<= 1)
+                {
+                    measure(&b, "block", "default", block, 0);
+                    measure(&b, "block", "default/tiled", block, BENCH_TILE_SIZE);
+                }
+            }
+            destroy(&b);
+        }
+    }
+
+    PTEST_MAIN
+    {
+        // The rows of results are written to the CSV file if specified
+        pOut    = NULL;
+        if (argc > 0)
+        {
+            pOut    = fopen(argv[0], "w");
+            if (pOut == NULL)
+                printf("Could not create output file %s\n", argv[0]);
+            else
+                fputs("section,variant,config,sample_rate,block,tile,ns_per_sample,samples_per_second\n", pOut);
+        }
+        lsp_finally
+        {
+            if (pOut != NULL)
+                fclose(pOut);
+        };
+
+        ipc::NativeExecutor executor;
+        if (executor.start() != STATUS_OK)
+            return;
+
+        bench_generators(&executor);
+        PTEST_SEPARATOR;
+        bench_sample_rates(&executor);
+        PTEST_SEPARATOR;
+        bench_block_sizes(&executor);
+        PTEST_SEPARATOR2;
+
+        executor.shutdown();
+    }
+
+PTEST_END
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 16 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/plugins/noise_dist.h>
+
+#include <math.h>
+
+#define TEST_RANK               20          // Number of samples for the statistics is 2^TEST_RANK
+#define LOG_TOLERANCE           2e-6        // Absolute error of logarithm
+#define SQRT_TOLERANCE          1e-5        // Relative error of square root
+#define SINCOS_TOLERANCE        1e-5        // Absolute error of sine and cosine
+#define MEAN_TOLERANCE          3e-3        // About 5 standard errors of the mean
+#define VAR_TOLERANCE           1e-2        // Relative error of the variance
+
+namespace
+{
+    using namespace lsp;
+
+    typedef void (*dist_t)(float *dst, const uint32_t *src, size_t count);
+
+    typedef struct dist_test_t
+    {
+        const char     *id;
+        dist_t          func;
+    } dist_test_t;
+
+    static const dist_test_t dists[] =
+    {
+        { "uniform",        plugins::noise_dist::uniform       },
+        { "exponential",    plugins::noise_dist::exponential   },
+        { "triangular",     plugins::noise_dist::triangular    },
+        { "gaussian",       plugins::noise_dist::gaussian      },
+        { NULL,             NULL                                    }
+    };
+}
+
+UTEST_BEGIN("noise_generator", noise_dist)
+
+    void test_log()
+    {
+        // All arguments which are passed by the distributions: 24-bit numbers in the range (0, 1)
+        double max_err  = 0.0;
+        for (uint32_t i=0; i < (1 << 24); ++i)
+        {
+            const float x   = float(i | 1) * (1.0f / 16777216.0f);
+            max_err         = lsp_max(max_err, fabs(plugins::noise_dist::fast_log(x) - log(double(x))));
+        }
+
+        printf("fast_log: maximum absolute error: %g\n", max_err);
+        UTEST_ASSERT_MSG(max_err < LOG_TOLERANCE, "fast_log error %g exceeds %g", max_err, LOG_TOLERANCE);
+    }
+
+    void test_sqrt()
+    {
+        double max_err  = 0.0;
+        for (float x = 1e-6f; x < 1e+6f; x *= 1.0001f)
+        {
+            const double ref    = sqrt(double(x));
+            max_err             = lsp_max(max_err, fabs(plugins::noise_dist::fast_sqrt(x) - ref) / ref);
+        }
+
+        printf("fast_sqrt: maximum relative error: %g\n", max_err);
+        UTEST_ASSERT_MSG(max_err < SQRT_TOLERANCE, "fast_sqrt error %g exceeds %g", max_err, SQRT_TOLERANCE);
+    }
+
+    void test_sincos()
+    {
+        // Half angles in the same range and resolution as in the gaussian distribution
+        double max_err  = 0.0;
+        for (uint32_t i=0; i < (1 << 24); ++i)
+        {
+            const float h   = (float(i) * (1.0f / 16777216.0f) - 0.5f) * float(M_PI);
+            float s, c;
+            plugins::noise_dist::fast_sincos(h, &s, &c);
+            max_err         = lsp_max(max_err, fabs(s - sin(2.0 * h)));
+            max_err         = lsp_max(max_err, fabs(c - cos(2.0 * h)));
+        }
+
+        printf("fast_sincos: maximum absolute error: %g\n", max_err);
+        UTEST_ASSERT_MSG(max_err < SINCOS_TOLERANCE, "fast_sincos error %g exceeds %g", max_err, SINCOS_TOLERANCE);
+    }
+
+    void test_dist(const dist_test_t *t, float *dst, const uint32_t *src, size_t count)
+    {
+        t->func(dst, src, count);
+
+        double mean = 0.0;
+        for (size_t i=0; i<count; ++i)
+            mean       += dst[i];
+        mean       /= count;
+
+        double var  = 0.0;
+        for (size_t i=0; i<count; ++i)
+            var        += (dst[i] - mean) * (dst[i] - mean);
+        var        /= count;
+
+        // All distributions should have the power of uniform distribution in the range [-1, 1)
+        const double ref    = 1.0 / 3.0;
+        printf("%s: mean = %g, variance = %g (expected %g)\n", t->id, mean, var, ref);
+        UTEST_ASSERT_MSG(fabs(mean) < MEAN_TOLERANCE,
+            "%s: mean %g is not zero", t->id, mean);
+        UTEST_ASSERT_MSG(fabs(var - ref) < ref * VAR_TOLERANCE,
+            "%s: variance %g differs from %g", t->id, var, ref);
+    }
+
+    UTEST_MAIN
+    {
+        test_log();
+        test_sqrt();
+        test_sincos();
+
+        // Fill the source with xorshift random numbers
+        const size_t count  = 1 << TEST_RANK;
+        uint8_t *data       = NULL;
+        float *dst          = alloc_aligned<float>(data, count * 2, 64);
+        UTEST_ASSERT(dst != NULL);
+        lsp_finally { free_aligned(data); };
+        uint32_t *src       = reinterpret_cast<uint32_t *>(&dst[count]);
+
+        uint32_t x          = 0x12345678;
+        for (size_t i=0; i<count; ++i)
+        {
+            x                  ^= x << 13;
+            x                  ^= x >> 17;
+            x                  ^= x << 5;
+            src[i]              = x;
+        }
+
+        for (const dist_test_t *t = dists; t->id != NULL; ++t)
+            test_dist(t, dst, src, count);
+    }
+
+UTEST_END
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Stefano Tronci <stefano.tronci@protonmail.com>
+ *
+ * This file is part of lsp-plugins
+ * Created on: 16 Oct 2026
+ *
+ * lsp-plugins is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/meta/noise_generator.h>
+#include <private/plugins/noise_generator.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SAMPLE_RATE        48000       // Sample rate
+#define TEST_BLOCK_SIZE         512         // Number of samples processed per one call
+#define TEST_WARMUP_BLOCKS      20          // Number of blocks rendered before reseeding
+#define TEST_BLOCKS             20          // Number of blocks compared after reseeding
+
+namespace
+{
+    using namespace lsp;
+
+    /**
+     * Port of the test host: control ports keep their value, audio ports
+     * refer to the block buffer, all other ports are not connected
+     */
+    class Port: public plug::IPort
+    {
+        protected:
+            float       fValue;
+            float      *pBuffer;
+
+        public:
+            explicit Port(const meta::port_t *meta): plug::IPort(meta)
+            {
+                fValue      = meta->start;
+                pBuffer     = NULL;
+            }
+
+        public:
+            virtual float value() override              { return fValue; }
+            virtual void set_value(float value) override { fValue = value; }
+            virtual void *buffer() override             { return pBuffer; }
+
+            void bind(float *buf)                       { pBuffer = buf; }
+    };
+
+    /**
+     * Wrapper of the test host: no executor, so everything is rendered by the calling thread
+     */
+    class Wrapper: public plug::IWrapper
+    {
+        public:
+            explicit Wrapper(plug::Module *plugin): plug::IWrapper(plugin, NULL)
+            {
+            }
+    };
+
+    typedef struct config_t
+    {
+        const char     *id;
+        size_t          type;
+        size_t          color;
+        bool            inaudible;
+        size_t          filter;
+    } config_t;
+
+    // Each configuration passes the stream through filters which keep their state between blocks
+    static const config_t configs[] =
+    {
+        { "lcg/pink/butterworth",   meta::noise_generator_metadata::NOISE_TYPE_LCG,         meta::noise_generator_metadata::NOISE_COLOR_PINK,   true,   meta::noise_generator_metadata::NOISE_INA_BUTTERWORTH },
+        { "lcg/red/chebyshev",      meta::noise_generator_metadata::NOISE_TYPE_LCG,         meta::noise_generator_metadata::NOISE_COLOR_RED,    true,   meta::noise_generator_metadata::NOISE_INA_CHEBYSHEV },
+        { "mls/blue",               meta::noise_generator_metadata::NOISE_TYPE_MLS,         meta::noise_generator_metadata::NOISE_COLOR_BLUE,   false,  meta::noise_generator_metadata::NOISE_INA_BUTTERWORTH },
+        { "velvet/violet",          meta::noise_generator_metadata::NOISE_TYPE_VELVET,      meta::noise_generator_metadata::NOISE_COLOR_VIOLET, false,  meta::noise_generator_metadata::NOISE_INA_BUTTERWORTH },
+        { "spectral/pink",          meta::noise_generator_metadata::NOISE_TYPE_SPECTRAL,    meta::noise_generator_metadata::NOISE_COLOR_PINK,   false,  meta::noise_generator_metadata::NOISE_INA_BUTTERWORTH },
+        { "counter/red/butterworth",meta::noise_generator_metadata::NOISE_TYPE_COUNTER,     meta::noise_generator_metadata::NOISE_COLOR_RED,    true,   meta::noise_generator_metadata::NOISE_INA_BUTTERWORTH },
+        { NULL, 0, 0, false, 0 }
+    };
+
+    /**
+     * Plugin instance with the synthetic ports and the block buffers
+     */
+    typedef struct instance_t
+    {
+        plugins::noise_generator   *plugin;
+        Wrapper                    *wrapper;
+        plug::IPort               **ports;
+        size_t                      num_ports;
+        float                      *buf;
+        float                      *out;
+        uint8_t                    *data;
+    } instance_t;
+}
+
+UTEST_BEGIN("noise_generator", reseed)
+
+    void set_port(instance_t *inst, const char *id, float value)
+    {
+        for (size_t i=0; i<inst->num_ports; ++i)
+            if (!strcmp(inst->ports[i]->metadata()->id, id))
+            {
+                inst->ports[i]->set_value(value);
+                return;
+            }
+        UTEST_FAIL_MSG("Port '%s' not found", id);
+    }
+
+    void create(instance_t *inst, const config_t *cfg)
+    {
+        const meta::plugin_t *meta = &meta::noise_generator_x1;
+
+        // Create ports
+        inst->num_ports = 0;
+        for (const meta::port_t *p = meta->ports; p->id != NULL; ++p)
+            ++inst->num_ports;
+        inst->ports     = static_cast<plug::IPort **>(malloc(inst->num_ports * sizeof(plug::IPort *)));
+        UTEST_ASSERT(inst->ports != NULL);
+        for (size_t i=0; i<inst->num_ports; ++i)
+            inst->ports[i]  = new Port(&meta->ports[i]);
+
+        // Bind zero-filled input and the output buffer
+        inst->buf       = alloc_aligned<float>(inst->data, TEST_BLOCK_SIZE * 2, DEFAULT_ALIGN);
+        UTEST_ASSERT(inst->buf != NULL);
+        dsp::fill_zero(inst->buf, TEST_BLOCK_SIZE * 2);
+        inst->out       = &inst->buf[TEST_BLOCK_SIZE];
+        for (size_t i=0; i<inst->num_ports; ++i)
+        {
+            const meta::port_t *p   = inst->ports[i]->metadata();
+            if (meta::is_audio_in_port(p))
+                static_cast<Port *>(inst->ports[i])->bind(inst->buf);
+            else if (meta::is_audio_out_port(p))
+                static_cast<Port *>(inst->ports[i])->bind(inst->out);
+        }
+
+        // Configure the first generator, the stream depends only on the seed
+        set_port(inst, "dsd", 1.0f);
+        set_port(inst, "seed", 1.0f);
+        set_port(inst, "nt_1", cfg->type);
+        set_port(inst, "cs_1", cfg->color);
+        set_port(inst, "ni_1", (cfg->inaudible) ? 1.0f : 0.0f);
+        set_port(inst, "nif_1", cfg->filter);
+
+        // Create and initialize the plugin
+        inst->plugin    = new plugins::noise_generator(meta);
+        inst->wrapper   = new Wrapper(inst->plugin);
+        inst->plugin->init(inst->wrapper, inst->ports);
+        inst->plugin->set_sample_rate(TEST_SAMPLE_RATE);
+        inst->plugin->activate();
+        inst->plugin->update_settings();
+    }
+
+    void destroy(instance_t *inst)
+    {
+        inst->plugin->deactivate();
+        inst->plugin->destroy();
+        delete inst->plugin;
+        delete inst->wrapper;
+        for (size_t i=0; i<inst->num_ports; ++i)
+            delete inst->ports[i];
+        free(inst->ports);
+        free_aligned(inst->data);
+    }
+
+    void test_config(const config_t *cfg)
+    {
+        printf("Testing %s...\n", cfg->id);
+
+        instance_t a, b;
+        create(&a, cfg);
+        create(&b, cfg);
+
+        // Render the stream with the first seed, so the filters get some state
+        for (size_t i=0; i<TEST_WARMUP_BLOCKS; ++i)
+        {
+            a.plugin->process(TEST_BLOCK_SIZE);
+            b.plugin->process(TEST_BLOCK_SIZE);
+        }
+
+        // Change the seed: the first instance is reseeded in place, the second one
+        // is then restarted at the beginning of the new stream
+        set_port(&a, "seed", 2.0f);
+        set_port(&b, "seed", 2.0f);
+        a.plugin->update_settings();
+        b.plugin->update_settings();
+
+        plugins::noise_generator::snapshot_t s;
+        UTEST_ASSERT(b.plugin->snapshot(0, &s));
+        UTEST_ASSERT(s.nPosition == 0);
+        UTEST_ASSERT(b.plugin->restore(0, &s));
+
+        // Both streams should match sample for sample
+        for (size_t i=0; i<TEST_BLOCKS; ++i)
+        {
+            a.plugin->process(TEST_BLOCK_SIZE);
+            b.plugin->process(TEST_BLOCK_SIZE);
+            for (size_t j=0; j<TEST_BLOCK_SIZE; ++j)
+            {
+                UTEST_ASSERT_MSG(a.out[j] == b.out[j],
+                    "%s: reseeded sample %d = %.8f differs from restarted sample %.8f",
+                    cfg->id, int(i * TEST_BLOCK_SIZE + j), a.out[j], b.out[j]);
+            }
+        }
+
+        destroy(&a);
+        destroy(&b);
+    }
+
+    UTEST_MAIN
+    {
+        for (const config_t *cfg = configs; cfg->id != NULL; ++cfg)
+            test_config(cfg);
+    }
+
+UTEST_END